@@ -0,0 +1,499 @@
+/*
+ * HASH-TABLE DISTRIBUTION AND COLLISION ANALYZER OF THE ALL HASH ALGORITHMS
+ * build, from the repository root:
+ *   g++ -std=c++20 -O2 -pthread analyzer/analyzer.cpp -o hash_analyzer
+ *   cl /std:c++20 /O2 /EHsc analyzer\analyzer.cpp /Fe:hash_analyzer.exe
+ * usage:
+ *   hash_analyzer [--keys <path>] [--count <keys>] [--corpus <name>] [--filter <name>]
+ * where '--keys' reads one key per line from the given file instead of the generated corpora
+ */
+#ifndef Q_HAS_INCLUDE
+#define Q_HAS_INCLUDE(HEADER) __has_include(HEADER)
+#endif
+
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] printf, fprintf, fopen, fgetc, fclose, snprintf
+#include <cstdio>
+// used: [crt] strcmp, strstr, strlen
+#include <cstring>
+// used: [crt] strtoull
+#include <cstdlib>
+// used: [stl] sort, min, max
+#include <algorithm>
+// used: [stl] abs, ldexp
+#include <cmath>
+// used: [stl] steady_clock
+#include <chrono>
+// used: [stl] string, to_string
+#include <string>
+// used: [stl] vector
+#include <vector>
+
+#include "../crc32.h"
+#include "../crc32c.h"
+#include "../crc64.h"
+#include "../djb2.h"
+#include "../djb2a.h"
+#include "../fnv1a.h"
+#include "../fnv1a_64.h"
+#include "../murmur2.h"
+#include "../murmur2a.h"
+#include "../murmur2_64.h"
+#include "../murmur3.h"
+#include "../murmur3_128.h"
+#include "../xxh64.h"
+#include "../xxh3.h"
+
+namespace ANALYZER
+{
+	// count of the low hash bits checked for the avalanche bias, enough to index the tables of up to 64K buckets
+	inline constexpr int nAvalancheBits = 16;
+	// count of the keys which input bits are flipped for the avalanche check
+	inline constexpr std::size_t nAvalancheKeys = 2000U;
+
+	// prevents the results from being optimized out
+	volatile std::uint64_t ullSink = 0U;
+
+	/* @section: algorithms */
+	struct Algorithm_t
+	{
+		const char* szName;
+		// width of the hash in bits, only the low 64 bits of the wider results are analyzed, as a table would use them
+		int nBits;
+		std::uint64_t(*pfnHash)(const std::uint8_t*, std::size_t) noexcept;
+	};
+
+	template <typename T>
+	constexpr std::uint64_t Fold(const T uHash) noexcept
+	{
+		return static_cast<std::uint64_t>(uHash);
+	}
+
+	constexpr std::uint64_t Fold(const MurMur3128_t hash) noexcept
+	{
+		return hash.ullLow;
+	}
+
+	constexpr std::uint64_t Fold(const XXH3128_t hash) noexcept
+	{
+		return hash.ullLow;
+	}
+
+#define ANALYZER_ENTRY(NAME, NAMESPACE, BITS, LENGTH_T) { NAME, BITS, [](const std::uint8_t* pSource, const std::size_t nLength) noexcept { return Fold(NAMESPACE::Hash(pSource, static_cast<LENGTH_T>(nLength))); } }
+
+	inline constexpr Algorithm_t arrAlgorithms[] =
+	{
+		ANALYZER_ENTRY("crc32", CRC32, 32, std::size_t),
+		ANALYZER_ENTRY("crc32c", CRC32C, 32, std::size_t),
+		ANALYZER_ENTRY("crc64", CRC64, 64, std::size_t),
+		ANALYZER_ENTRY("djb2", DJB2, 32, std::uint32_t),
+		ANALYZER_ENTRY("djb2a", DJB2A, 32, std::uint32_t),
+		ANALYZER_ENTRY("fnv1a", FNV1A, 32, std::uint32_t),
+		ANALYZER_ENTRY("fnv1a_64", FNV1A_64, 64, std::size_t),
+		ANALYZER_ENTRY("murmur2", MURMUR2, 32, std::uint32_t),
+		ANALYZER_ENTRY("murmur2a", MURMUR2A, 32, std::uint32_t),
+		ANALYZER_ENTRY("murmur2_64", MURMUR2_64, 64, std::size_t),
+		ANALYZER_ENTRY("murmur3", MURMUR3, 32, std::uint32_t),
+		ANALYZER_ENTRY("murmur3_128", MURMUR3_128, 64, std::size_t),
+		ANALYZER_ENTRY("murmur3_x86_128", MURMUR3_X86_128, 64, std::size_t),
+		ANALYZER_ENTRY("xxh64", XXH64, 64, std::size_t),
+		ANALYZER_ENTRY("xxh3", XXH3, 64, std::size_t),
+		ANALYZER_ENTRY("xxh3_128", XXH3_128, 64, std::size_t)
+	};
+
+	/* @section: corpora */
+	struct Corpus_t
+	{
+		std::string strName;
+		std::vector<std::string> vecKeys;
+	};
+
+	/// decimal sequential identifiers, e.g. "1000000", "1000001", ...
+	Corpus_t MakeDecimalCorpus(const std::size_t nCount)
+	{
+		Corpus_t corpus = { "decimal_ids", { } };
+		corpus.vecKeys.reserve(nCount);
+
+		for (std::size_t i = 0U; i < nCount; ++i)
+			corpus.vecKeys.push_back(std::to_string(1000000U + i));
+
+		return corpus;
+	}
+
+	/// binary little-endian sequential 32-bit identifiers
+	Corpus_t MakeBinaryCorpus(const std::size_t nCount)
+	{
+		Corpus_t corpus = { "binary_ids", { } };
+		corpus.vecKeys.reserve(nCount);
+
+		for (std::size_t i = 0U; i < nCount; ++i)
+		{
+			const std::uint32_t uIdentifier = static_cast<std::uint32_t>(i);
+			const char arrBytes[4] = { static_cast<char>(uIdentifier), static_cast<char>(uIdentifier >> 8U), static_cast<char>(uIdentifier >> 16U), static_cast<char>(uIdentifier >> 24U) };
+			corpus.vecKeys.emplace_back(arrBytes, sizeof(arrBytes));
+		}
+
+		return corpus;
+	}
+
+	/// file system path-like strings with the long shared prefixes, e.g. "/srv/data/project12/module3/file45.dat"
+	Corpus_t MakePathCorpus(const std::size_t nCount)
+	{
+		Corpus_t corpus = { "paths", { } };
+		corpus.vecKeys.reserve(nCount);
+
+		char szPath[128];
+		for (std::size_t i = 0U; i < nCount; ++i)
+		{
+			std::snprintf(szPath, sizeof(szPath), "/srv/data/project%zu/module%zu/file%zu.dat", i / 4096U, (i / 64U) % 64U, i % 64U);
+			corpus.vecKeys.emplace_back(szPath);
+		}
+
+		return corpus;
+	}
+
+	/// random alphanumeric strings of 8 to 24 characters
+	Corpus_t MakeRandomCorpus(const std::size_t nCount)
+	{
+		Corpus_t corpus = { "random", { } };
+		corpus.vecKeys.reserve(nCount);
+
+		constexpr char szAlphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+		std::uint64_t ullRandom = 0x9E3779B97F4A7C15;
+		const auto Next = [&ullRandom]()
+		{
+			ullRandom ^= ullRandom << 13U;
+			ullRandom ^= ullRandom >> 7U;
+			ullRandom ^= ullRandom << 17U;
+			return ullRandom;
+		};
+
+		for (std::size_t i = 0U; i < nCount; ++i)
+		{
+			std::string strKey(8U + Next() % 17U, '\0');
+			for (char& chKey : strKey)
+				chKey = szAlphabet[Next() % (sizeof(szAlphabet) - 1U)];
+
+			corpus.vecKeys.push_back(std::move(strKey));
+		}
+
+		return corpus;
+	}
+
+	/// @returns: true if the keys have been read successfully, one per line
+	bool ReadCorpus(const char* szPath, Corpus_t& corpus)
+	{
+		std::FILE* hFile = std::fopen(szPath, "rb");
+		if (hFile == nullptr)
+			return false;
+
+		corpus.strName = szPath;
+
+		std::string strLine;
+		for (int iCharacter; (iCharacter = std::fgetc(hFile)) != EOF;)
+		{
+			if (iCharacter == '\n')
+			{
+				if (!strLine.empty() && strLine.back() == '\r')
+					strLine.pop_back();
+
+				corpus.vecKeys.push_back(std::move(strLine));
+				strLine.clear();
+			}
+			else
+				strLine.push_back(static_cast<char>(iCharacter));
+		}
+
+		if (!strLine.empty())
+			corpus.vecKeys.push_back(std::move(strLine));
+
+		std::fclose(hFile);
+		return !corpus.vecKeys.empty();
+	}
+
+	/* @section: metrics */
+	struct Report_t
+	{
+		double flNanosecondsPerKey;
+		// count of the keys which full hash equals to the hash of some other key
+		std::size_t nCollisions;
+		double flExpectedCollisions;
+		// bucket load variance relative to the ideal random hash, 1.0 is ideal
+		double flPowerOfTwoVariance;
+		double flPrimeVariance;
+		// maximal and mean probe length of the linear probing table at the half load
+		std::size_t nPowerOfTwoMaxProbe;
+		double flPowerOfTwoMeanProbe;
+		std::size_t nPrimeMaxProbe;
+		double flPrimeMeanProbe;
+		// the worst deviation of the low output bit flip probability from 0.5, as a fraction of 0.5
+		double flAvalancheBias;
+	};
+
+	/// @returns: the smallest prime that is not less than given value
+	std::size_t NextPrime(std::size_t nValue)
+	{
+		const auto IsPrime = [](const std::size_t nNumber)
+		{
+			if (nNumber < 2U)
+				return false;
+
+			for (std::size_t nDivisor = 2U; nDivisor * nDivisor <= nNumber; ++nDivisor)
+			{
+				if (nNumber % nDivisor == 0U)
+					return false;
+			}
+
+			return true;
+		};
+
+		while (!IsPrime(nValue))
+			++nValue;
+
+		return nValue;
+	}
+
+	/// @returns: variance of the bucket loads divided by the variance expected from the ideal random hash
+	double MeasureLoadVariance(const std::vector<std::uint64_t>& vecHashes, const std::size_t nBuckets, const bool bPowerOfTwo)
+	{
+		std::vector<std::uint32_t> vecLoads(nBuckets, 0U);
+		for (const std::uint64_t ullHash : vecHashes)
+			++vecLoads[bPowerOfTwo ? (ullHash & (nBuckets - 1U)) : (ullHash % nBuckets)];
+
+		const double flMean = static_cast<double>(vecHashes.size()) / static_cast<double>(nBuckets);
+		double flVariance = 0.0;
+		for (const std::uint32_t uLoad : vecLoads)
+			flVariance += (uLoad - flMean) * (uLoad - flMean);
+
+		flVariance /= static_cast<double>(nBuckets);
+
+		// binomial variance of the ideal hash
+		const double flExpected = flMean * (1.0 - 1.0 / static_cast<double>(nBuckets));
+		return flVariance / flExpected;
+	}
+
+	/// insert all hashes into the linear probing table of the given size
+	/// @returns: maximal probe length and writes the mean one
+	std::size_t MeasureProbeLength(const std::vector<std::uint64_t>& vecHashes, const std::size_t nSlots, const bool bPowerOfTwo, double& flMeanProbe)
+	{
+		std::vector<bool> vecOccupied(nSlots, false);
+		std::size_t nMaxProbe = 0U, nTotalProbe = 0U;
+
+		for (const std::uint64_t ullHash : vecHashes)
+		{
+			std::size_t nSlot = bPowerOfTwo ? (ullHash & (nSlots - 1U)) : (ullHash % nSlots);
+			std::size_t nProbe = 0U;
+
+			while (vecOccupied[nSlot])
+			{
+				++nProbe;
+				nSlot = (nSlot + 1U == nSlots) ? 0U : nSlot + 1U;
+			}
+
+			vecOccupied[nSlot] = true;
+			nMaxProbe = std::max(nMaxProbe, nProbe);
+			nTotalProbe += nProbe;
+		}
+
+		flMeanProbe = static_cast<double>(nTotalProbe) / static_cast<double>(vecHashes.size());
+		return nMaxProbe;
+	}
+
+	/// flip each input bit of the sampled keys and count how often each of the low output bits changes
+	/// @returns: the worst deviation of the flip probability from 0.5, as a fraction of 0.5
+	double MeasureAvalancheBias(const Algorithm_t& algorithm, const std::vector<std::string>& vecKeys)
+	{
+		std::size_t arrFlips[nAvalancheBits] = { };
+		std::size_t nTrials = 0U;
+
+		const std::size_t nStep = std::max<std::size_t>(1U, vecKeys.size() / nAvalancheKeys);
+		std::string strFlipped;
+
+		for (std::size_t nKey = 0U; nKey < vecKeys.size(); nKey += nStep)
+		{
+			const std::string& strKey = vecKeys[nKey];
+			const std::uint64_t ullHash = algorithm.pfnHash(reinterpret_cast<const std::uint8_t*>(strKey.data()), strKey.size());
+
+			strFlipped = strKey;
+			for (std::size_t nBit = 0U; nBit < strKey.size() * 8U; ++nBit)
+			{
+				strFlipped[nBit / 8U] ^= static_cast<char>(1U << (nBit % 8U));
+				const std::uint64_t ullDifference = ullHash ^ algorithm.pfnHash(reinterpret_cast<const std::uint8_t*>(strFlipped.data()), strFlipped.size());
+				strFlipped[nBit / 8U] = strKey[nBit / 8U];
+
+				for (int nOutputBit = 0; nOutputBit < nAvalancheBits; ++nOutputBit)
+					arrFlips[nOutputBit] += (ullDifference >> nOutputBit) & 1U;
+
+				++nTrials;
+			}
+		}
+
+		if (nTrials == 0U)
+			return 0.0;
+
+		double flWorstBias = 0.0;
+		for (const std::size_t nFlips : arrFlips)
+			flWorstBias = std::max(flWorstBias, std::abs(static_cast<double>(nFlips) / static_cast<double>(nTrials) - 0.5) * 2.0);
+
+		return flWorstBias;
+	}
+
+	Report_t Analyze(const Algorithm_t& algorithm, const Corpus_t& corpus)
+	{
+		Report_t report = { };
+		const std::vector<std::string>& vecKeys = corpus.vecKeys;
+
+		std::vector<std::uint64_t> vecHashes(vecKeys.size());
+
+		// take the fastest of the few runs
+		double flBestSeconds = 1e30;
+		for (int nRun = 0; nRun < 3; ++nRun)
+		{
+			const auto timeBegin = std::chrono::steady_clock::now();
+			for (std::size_t i = 0U; i < vecKeys.size(); ++i)
+				vecHashes[i] = algorithm.pfnHash(reinterpret_cast<const std::uint8_t*>(vecKeys[i].data()), vecKeys[i].size());
+
+			flBestSeconds = std::min(flBestSeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - timeBegin).count());
+		}
+
+		ullSink = ullSink + vecHashes.front();
+		report.flNanosecondsPerKey = flBestSeconds * 1e9 / static_cast<double>(vecKeys.size());
+
+		// collisions of the full hash
+		{
+			std::vector<std::uint64_t> vecSorted = vecHashes;
+			std::sort(vecSorted.begin(), vecSorted.end());
+
+			for (std::size_t i = 0U; i < vecSorted.size();)
+			{
+				std::size_t nEnd = i + 1U;
+				while (nEnd < vecSorted.size() && vecSorted[nEnd] == vecSorted[i])
+					++nEnd;
+
+				if (nEnd - i > 1U)
+					report.nCollisions += nEnd - i;
+
+				i = nEnd;
+			}
+
+			// pairs expected from the ideal hash, each collided pair involves two keys
+			const double flKeys = static_cast<double>(vecKeys.size());
+			report.flExpectedCollisions = 2.0 * (flKeys * (flKeys - 1.0) / 2.0) / std::ldexp(1.0, algorithm.nBits);
+		}
+
+		// the chained table at the load factor of 1
+		std::size_t nPowerOfTwo = 1U;
+		while (nPowerOfTwo < vecKeys.size())
+			nPowerOfTwo <<= 1U;
+
+		report.flPowerOfTwoVariance = MeasureLoadVariance(vecHashes, nPowerOfTwo, true);
+		report.flPrimeVariance = MeasureLoadVariance(vecHashes, NextPrime(nPowerOfTwo), false);
+
+		// the open addressing table at the load factor of 0.5
+		report.nPowerOfTwoMaxProbe = MeasureProbeLength(vecHashes, nPowerOfTwo * 2U, true, report.flPowerOfTwoMeanProbe);
+		report.nPrimeMaxProbe = MeasureProbeLength(vecHashes, NextPrime(nPowerOfTwo * 2U), false, report.flPrimeMeanProbe);
+
+		report.flAvalancheBias = MeasureAvalancheBias(algorithm, vecKeys);
+		return report;
+	}
+
+	/* @section: options */
+	struct Options_t
+	{
+		const char* szKeysPath = nullptr;
+		const char* szCorpusFilter = nullptr;
+		const char* szFilter = nullptr;
+		std::size_t nCount = 1U << 20U;
+	};
+
+	bool ParseOptions(const int nArguments, char** arrArguments, Options_t& options)
+	{
+		for (int i = 1; i < nArguments; ++i)
+		{
+			const char* szOption = arrArguments[i];
+			if (i + 1 >= nArguments)
+				return false;
+
+			const char* szValue = arrArguments[++i];
+			if (std::strcmp(szOption, "--keys") == 0)
+				options.szKeysPath = szValue;
+			else if (std::strcmp(szOption, "--corpus") == 0)
+				options.szCorpusFilter = szValue;
+			else if (std::strcmp(szOption, "--filter") == 0)
+				options.szFilter = szValue;
+			else if (std::strcmp(szOption, "--count") == 0)
+				options.nCount = static_cast<std::size_t>(std::strtoull(szValue, nullptr, 10));
+			else
+				return false;
+		}
+
+		return options.nCount != 0U;
+	}
+}
+
+int main(int nArguments, char** arrArguments)
+{
+	using namespace ANALYZER;
+
+	Options_t options;
+	if (!ParseOptions(nArguments, arrArguments, options))
+	{
+		std::fprintf(stderr, "usage: %s [--keys <path>] [--count <keys>] [--corpus <name>] [--filter <name>]\n", arrArguments[0]);
+		return 1;
+	}
+
+	std::vector<Corpus_t> vecCorpora;
+	if (options.szKeysPath != nullptr)
+	{
+		Corpus_t corpus;
+		if (!ReadCorpus(options.szKeysPath, corpus))
+		{
+			std::fprintf(stderr, "failed to read keys from '%s'\n", options.szKeysPath);
+			return 1;
+		}
+
+		vecCorpora.push_back(std::move(corpus));
+	}
+	else
+	{
+		vecCorpora.push_back(MakeDecimalCorpus(options.nCount));
+		vecCorpora.push_back(MakeBinaryCorpus(options.nCount));
+		vecCorpora.push_back(MakePathCorpus(options.nCount));
+		vecCorpora.push_back(MakeRandomCorpus(options.nCount));
+	}
+
+	for (const Corpus_t& corpus : vecCorpora)
+	{
+		if (options.szCorpusFilter != nullptr && corpus.strName.find(options.szCorpusFilter) == std::string::npos)
+			continue;
+
+		std::printf("corpus '%s', %zu keys\n", corpus.strName.c_str(), corpus.vecKeys.size());
+		std::printf("%-16s %8s %11s %9s %9s %14s %14s %9s\n", "algorithm", "ns/key", "collisions", "var(2^n)", "var(p)", "probe(2^n)", "probe(p)", "avalanche");
+
+		for (const Algorithm_t& algorithm : arrAlgorithms)
+		{
+			if (options.szFilter != nullptr && std::strstr(algorithm.szName, options.szFilter) == nullptr)
+				continue;
+
+			const Report_t report = Analyze(algorithm, corpus);
+
+			char szCollisions[32], szPowerOfTwoProbe[32], szPrimeProbe[32];
+			std::snprintf(szCollisions, sizeof(szCollisions), "%zu/%.0f", report.nCollisions, report.flExpectedCollisions);
+			std::snprintf(szPowerOfTwoProbe, sizeof(szPowerOfTwoProbe), "%zu/%.2f", report.nPowerOfTwoMaxProbe, report.flPowerOfTwoMeanProbe);
+			std::snprintf(szPrimeProbe, sizeof(szPrimeProbe), "%zu/%.2f", report.nPrimeMaxProbe, report.flPrimeMeanProbe);
+
+			std::printf("%-16s %8.2f %11s %9.3f %9.3f %14s %14s %9.3f\n", algorithm.szName, report.flNanosecondsPerKey, szCollisions, report.flPowerOfTwoVariance, report.flPrimeVariance, szPowerOfTwoProbe, szPrimeProbe, report.flAvalancheBias);
+		}
+
+		std::printf("\n");
+	}
+
+	std::printf("collisions: keys sharing the full hash / expected from the ideal hash\n");
+	std::printf("var: bucket load variance relative to the ideal hash at the load factor of 1, for the power of two and prime bucket counts\n");
+	std::printf("probe: maximal/mean probe length of the linear probing at the load factor of 0.5\n");
+	std::printf("avalanche: the worst bias of the low %d output bits on a single input bit flip, 0 is ideal and 1 is the bit never or always flips\n", nAvalancheBits);
+	return 0;
+}
@@ -0,0 +1,447 @@
+/*
+ * THROUGHPUT AND LATENCY BENCHMARK OF THE ALL HASH ALGORITHMS
+ * build, from the repository root:
+ *   g++ -std=c++20 -O2 -pthread benchmark/benchmark.cpp benchmark/crc32_nolut.cpp -o hash_benchmark
+ *   cl /std:c++20 /O2 /EHsc benchmark\benchmark.cpp benchmark\crc32_nolut.cpp /Fe:hash_benchmark.exe
+ * usage:
+ *   hash_benchmark [--filter <name>] [--max-size <bytes>] [--min-time <seconds>] [--samples <count>] [--csv <path>]
+ * @note: cycles are measured by the time-stamp counter on x86 CPUs, so they are reference cycles that don't follow the frequency scaling, elsewhere they are nanoseconds
+ */
+#ifndef Q_HAS_INCLUDE
+#define Q_HAS_INCLUDE(HEADER) __has_include(HEADER)
+#endif
+
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] printf, fprintf, fopen, fclose
+#include <cstdio>
+// used: [crt] strcmp, strstr
+#include <cstring>
+// used: [crt] strtoull, strtod
+#include <cstdlib>
+// used: [stl] sort, min
+#include <algorithm>
+// used: [stl] steady_clock
+#include <chrono>
+// used: [stl] vector
+#include <vector>
+
+#include "../crc32.h"
+#include "../crc32c.h"
+#include "../crc64.h"
+#include "../djb2.h"
+#include "../djb2a.h"
+#include "../fnv1a.h"
+#include "../fnv1a_64.h"
+#include "../murmur2.h"
+#include "../murmur2a.h"
+#include "../murmur2_64.h"
+#include "../murmur3.h"
+#include "../murmur3_128.h"
+#include "../xxh64.h"
+#include "../xxh3.h"
+
+#ifdef Q_HASH_CPU_X86
+#ifdef _MSC_VER
+// used: __rdtsc
+#include <intrin.h>
+#else
+// used: __rdtsc
+#include <x86intrin.h>
+#endif
+// used: [intrin] _mm_lfence
+#include <emmintrin.h>
+#endif
+
+namespace BENCHMARK
+{
+	// defined in the 'crc32_nolut.cpp'
+	std::uint64_t HashCRC32NoLUT(const std::uint8_t* pSource, std::size_t nLength) noexcept;
+	std::uint64_t HashCRC32NoLUT(const char* szSource) noexcept;
+
+	enum EOverload : int
+	{
+		OVERLOAD_BUFFER = 0,
+		OVERLOAD_STRING,
+		OVERLOAD_MAX
+	};
+
+	inline constexpr const char* arrOverloadNames[OVERLOAD_MAX] = { "buffer", "string" };
+
+	// key sizes of the throughput measurement
+	inline constexpr std::size_t arrThroughputSizes[] = { 1U, 4U, 8U, 16U, 32U, 64U, 256U, 1024U, 4096U, 65536U, 1048576U, 67108864U };
+	// key sizes of the latency measurement
+	inline constexpr std::size_t arrLatencySizes[] = { 1U, 2U, 4U, 8U, 16U, 32U, 64U };
+	// count of the dependent calls measured by the single latency sample, to amortize the timer overhead
+	inline constexpr std::size_t nLatencyChain = 8U;
+	// count of the repetitions of the throughput measurement, the fastest one is taken
+	inline constexpr int nThroughputRepetitions = 5;
+
+	// prevents the results from being optimized out
+	volatile std::uint64_t ullSink = 0U;
+	// always zero, but unknown to the compiler, so it can't hoist loop-invariant calls out of the loop
+	volatile std::size_t nOpaqueZero = 0U;
+
+	/// @returns: current value of the timer, in cycles if available or nanoseconds otherwise
+	inline std::uint64_t ReadTimer() noexcept
+	{
+	#ifdef Q_HASH_CPU_X86
+		// don't let the measured instructions cross the timer read
+		_mm_lfence();
+		const std::uint64_t ullTicks = __rdtsc();
+		_mm_lfence();
+		return ullTicks;
+	#else
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	#endif
+	}
+
+	/// @returns: count of the timer ticks per second
+	double CalibrateTimer()
+	{
+		const auto timeBegin = std::chrono::steady_clock::now();
+		const std::uint64_t ullBegin = ReadTimer();
+
+		while (std::chrono::steady_clock::now() - timeBegin < std::chrono::milliseconds(200))
+			;
+
+		const std::uint64_t ullEnd = ReadTimer();
+		const double flSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - timeBegin).count();
+		return static_cast<double>(ullEnd - ullBegin) / flSeconds;
+	}
+
+	/* @section: algorithms */
+	// adapters with the uniform signatures, so the measurements are shared, while the hash calls are still inlined into them
+	// wider results are folded to 64 bits
+#define BENCHMARK_ALGORITHM(NAME, NAMESPACE, LENGTH_T)                                            \
+	struct NAME                                                                                  \
+	{                                                                                            \
+		static std::uint64_t Buffer(const std::uint8_t* pSource, const std::size_t nLength) noexcept \
+		{                                                                                        \
+			return Fold(NAMESPACE::Hash(pSource, static_cast<LENGTH_T>(nLength)));               \
+		}                                                                                        \
+		static std::uint64_t String(const char* szSource) noexcept                               \
+		{                                                                                        \
+			return Fold(NAMESPACE::Hash(szSource));                                              \
+		}                                                                                        \
+	}
+
+	template <typename T>
+	constexpr std::uint64_t Fold(const T uHash) noexcept
+	{
+		return static_cast<std::uint64_t>(uHash);
+	}
+
+	constexpr std::uint64_t Fold(const MurMur3128_t hash) noexcept
+	{
+		return hash.ullLow ^ hash.ullHigh;
+	}
+
+	constexpr std::uint64_t Fold(const XXH3128_t hash) noexcept
+	{
+		return hash.ullLow ^ hash.ullHigh;
+	}
+
+	struct AlgorithmCRC32NoLUT
+	{
+		static std::uint64_t Buffer(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+		{
+			return HashCRC32NoLUT(pSource, nLength);
+		}
+
+		static std::uint64_t String(const char* szSource) noexcept
+		{
+			return HashCRC32NoLUT(szSource);
+		}
+	};
+
+	/// @returns: timer ticks per call of the given overload on the given key, the fastest of the repetitions
+	template <typename T>
+	double MeasureThroughput(std::uint8_t* pKey, const std::size_t nSize, const EOverload nOverload, const double flMinTicks)
+	{
+		const std::size_t nMask = nOpaqueZero;
+		std::uint64_t ullResult = 0U;
+
+		const auto RunBatch = [&](const std::size_t nIterations) -> std::uint64_t
+		{
+			const std::uint64_t ullBegin = ReadTimer();
+
+			if (nOverload == OVERLOAD_STRING)
+			{
+				for (std::size_t i = 0U; i < nIterations; ++i)
+					ullResult += T::String(reinterpret_cast<const char*>(pKey + (i & nMask)));
+			}
+			else
+			{
+				for (std::size_t i = 0U; i < nIterations; ++i)
+					ullResult += T::Buffer(pKey + (i & nMask), nSize);
+			}
+
+			return ReadTimer() - ullBegin;
+		};
+
+		// grow the batch until it runs long enough to be measured reliably
+		std::size_t nIterations = 1U;
+		while (static_cast<double>(RunBatch(nIterations)) < flMinTicks / nThroughputRepetitions)
+			nIterations *= 2U;
+
+		double flBestTicks = static_cast<double>(RunBatch(nIterations)) / static_cast<double>(nIterations);
+		for (int i = 1; i < nThroughputRepetitions; ++i)
+			flBestTicks = std::min(flBestTicks, static_cast<double>(RunBatch(nIterations)) / static_cast<double>(nIterations));
+
+		ullSink = ullSink + ullResult;
+		return flBestTicks;
+	}
+
+	struct Latency_t
+	{
+		double flMedian;
+		double flNinetieth;
+		double flNinetyNinth;
+	};
+
+	/// @returns: percentiles of the timer ticks per call, where each call depends on the result of the previous one
+	template <typename T>
+	Latency_t MeasureLatency(std::uint8_t* pKey, const std::size_t nSize, const EOverload nOverload, const std::size_t nSamples, const double flTimerOverhead)
+	{
+		const std::size_t nMask = nOpaqueZero;
+		std::vector<double> vecSamples(nSamples);
+		std::uint64_t ullHash = 0U;
+
+		for (double& flSample : vecSamples)
+		{
+			const std::uint64_t ullBegin = ReadTimer();
+
+			// the key address depends on the previous hash, so the calls can't overlap
+			if (nOverload == OVERLOAD_STRING)
+			{
+				for (std::size_t i = 0U; i < nLatencyChain; ++i)
+					ullHash = T::String(reinterpret_cast<const char*>(pKey + (ullHash & nMask)));
+			}
+			else
+			{
+				for (std::size_t i = 0U; i < nLatencyChain; ++i)
+					ullHash = T::Buffer(pKey + (ullHash & nMask), nSize);
+			}
+
+			flSample = (static_cast<double>(ReadTimer() - ullBegin) - flTimerOverhead) / static_cast<double>(nLatencyChain);
+		}
+
+		ullSink = ullSink + ullHash;
+
+		std::sort(vecSamples.begin(), vecSamples.end());
+		const auto Percentile = [&vecSamples](const double flPercent)
+		{
+			return vecSamples[static_cast<std::size_t>(flPercent / 100.0 * static_cast<double>(vecSamples.size() - 1U))];
+		};
+
+		return { Percentile(50.0), Percentile(90.0), Percentile(99.0) };
+	}
+
+	struct Algorithm_t
+	{
+		const char* szName;
+		double(*pfnMeasureThroughput)(std::uint8_t*, std::size_t, EOverload, double);
+		Latency_t(*pfnMeasureLatency)(std::uint8_t*, std::size_t, EOverload, std::size_t, double);
+	};
+
+	BENCHMARK_ALGORITHM(AlgorithmCRC32, CRC32, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmCRC32C, CRC32C, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmCRC64, CRC64, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmDJB2, DJB2, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmDJB2A, DJB2A, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmFNV1A, FNV1A, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmFNV1A64, FNV1A_64, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur2, MURMUR2, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur2A, MURMUR2A, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur264, MURMUR2_64, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur3, MURMUR3, std::uint32_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur3128, MURMUR3_128, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmMurMur3X86128, MURMUR3_X86_128, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmXXH64, XXH64, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmXXH3, XXH3, std::size_t);
+	BENCHMARK_ALGORITHM(AlgorithmXXH3128, XXH3_128, std::size_t);
+
+#define BENCHMARK_ENTRY(NAME, TYPE) { NAME, &MeasureThroughput<TYPE>, &MeasureLatency<TYPE> }
+
+	inline constexpr Algorithm_t arrAlgorithms[] =
+	{
+		BENCHMARK_ENTRY("crc32", AlgorithmCRC32),
+		BENCHMARK_ENTRY("crc32_nolut", AlgorithmCRC32NoLUT),
+		BENCHMARK_ENTRY("crc32c", AlgorithmCRC32C),
+		BENCHMARK_ENTRY("crc64", AlgorithmCRC64),
+		BENCHMARK_ENTRY("djb2", AlgorithmDJB2),
+		BENCHMARK_ENTRY("djb2a", AlgorithmDJB2A),
+		BENCHMARK_ENTRY("fnv1a", AlgorithmFNV1A),
+		BENCHMARK_ENTRY("fnv1a_64", AlgorithmFNV1A64),
+		BENCHMARK_ENTRY("murmur2", AlgorithmMurMur2),
+		BENCHMARK_ENTRY("murmur2a", AlgorithmMurMur2A),
+		BENCHMARK_ENTRY("murmur2_64", AlgorithmMurMur264),
+		BENCHMARK_ENTRY("murmur3", AlgorithmMurMur3),
+		BENCHMARK_ENTRY("murmur3_128", AlgorithmMurMur3128),
+		BENCHMARK_ENTRY("murmur3_x86_128", AlgorithmMurMur3X86128),
+		BENCHMARK_ENTRY("xxh64", AlgorithmXXH64),
+		BENCHMARK_ENTRY("xxh3", AlgorithmXXH3),
+		BENCHMARK_ENTRY("xxh3_128", AlgorithmXXH3128)
+	};
+
+	/* @section: options */
+	struct Options_t
+	{
+		const char* szFilter = nullptr;
+		const char* szCSVPath = nullptr;
+		std::size_t nMaxSize = 67108864U;
+		double flMinTime = 0.25;
+		std::size_t nSamples = 20000U;
+	};
+
+	bool ParseOptions(const int nArguments, char** arrArguments, Options_t& options)
+	{
+		for (int i = 1; i < nArguments; ++i)
+		{
+			const char* szOption = arrArguments[i];
+			if (i + 1 >= nArguments)
+				return false;
+
+			const char* szValue = arrArguments[++i];
+			if (std::strcmp(szOption, "--filter") == 0)
+				options.szFilter = szValue;
+			else if (std::strcmp(szOption, "--csv") == 0)
+				options.szCSVPath = szValue;
+			else if (std::strcmp(szOption, "--max-size") == 0)
+				options.nMaxSize = static_cast<std::size_t>(std::strtoull(szValue, nullptr, 10));
+			else if (std::strcmp(szOption, "--min-time") == 0)
+				options.flMinTime = std::strtod(szValue, nullptr);
+			else if (std::strcmp(szOption, "--samples") == 0)
+				options.nSamples = static_cast<std::size_t>(std::strtoull(szValue, nullptr, 10));
+			else
+				return false;
+		}
+
+		return options.nMaxSize != 0U && options.flMinTime > 0.0 && options.nSamples != 0U;
+	}
+}
+
+int main(int nArguments, char** arrArguments)
+{
+	using namespace BENCHMARK;
+
+	Options_t options;
+	if (!ParseOptions(nArguments, arrArguments, options))
+	{
+		std::fprintf(stderr, "usage: %s [--filter <name>] [--max-size <bytes>] [--min-time <seconds>] [--samples <count>] [--csv <path>]\n", arrArguments[0]);
+		return 1;
+	}
+
+	std::FILE* hCSV = nullptr;
+	if (options.szCSVPath != nullptr)
+	{
+		hCSV = std::fopen(options.szCSVPath, "w");
+		if (hCSV == nullptr)
+		{
+			std::fprintf(stderr, "failed to open '%s' for writing\n", options.szCSVPath);
+			return 1;
+		}
+
+		std::fprintf(hCSV, "kind,algorithm,overload,alignment,size,gb_per_s,cycles_per_byte,p50_cycles,p90_cycles,p99_cycles\n");
+	}
+
+	const double flTicksPerSecond = CalibrateTimer();
+	const double flMinTicks = options.flMinTime * flTicksPerSecond;
+
+	// measure the cost of the timer itself, to subtract it from the latency samples
+	double flTimerOverhead = 1e30;
+	for (int i = 0; i < 1000; ++i)
+	{
+		const std::uint64_t ullBegin = ReadTimer();
+		flTimerOverhead = std::min(flTimerOverhead, static_cast<double>(ReadTimer() - ullBegin));
+	}
+
+	// non-zero bytes, so the same data can be hashed as a null-terminated string
+	std::vector<std::uint8_t> vecStorage(options.nMaxSize + 128U);
+	std::uint32_t uRandom = 0x9E3779B9;
+	for (std::uint8_t& uByte : vecStorage)
+	{
+		uRandom ^= uRandom << 13U;
+		uRandom ^= uRandom >> 17U;
+		uRandom ^= uRandom << 5U;
+		uByte = static_cast<std::uint8_t>(uRandom % 255U + 1U);
+	}
+
+	std::uint8_t* pAligned = vecStorage.data() + ((64U - (reinterpret_cast<std::uintptr_t>(vecStorage.data()) & 63U)) & 63U);
+	std::uint8_t* const arrKeys[2] = { pAligned, pAligned + 1U };
+	const char* const arrAlignmentNames[2] = { "aligned", "misaligned" };
+
+	std::printf("timer: %.3f GHz\n\n", flTicksPerSecond / 1e9);
+	std::printf("%-16s %-7s %-10s %10s %10s %10s\n", "algorithm", "input", "alignment", "size", "GB/s", "cycles/B");
+
+	for (const Algorithm_t& algorithm : arrAlgorithms)
+	{
+		if (options.szFilter != nullptr && std::strstr(algorithm.szName, options.szFilter) == nullptr)
+			continue;
+
+		for (const std::size_t nSize : arrThroughputSizes)
+		{
+			if (nSize > options.nMaxSize)
+				break;
+
+			for (int nOverload = 0; nOverload < OVERLOAD_MAX; ++nOverload)
+			{
+				for (int nAlignment = 0; nAlignment < 2; ++nAlignment)
+				{
+					std::uint8_t* pKey = arrKeys[nAlignment];
+
+					// terminate the key for the string overload
+					const std::uint8_t uTerminated = pKey[nSize];
+					pKey[nSize] = '\0';
+
+					const double flTicks = algorithm.pfnMeasureThroughput(pKey, nSize, static_cast<EOverload>(nOverload), flMinTicks);
+					pKey[nSize] = uTerminated;
+
+					const double flGigabytesPerSecond = static_cast<double>(nSize) / (flTicks / flTicksPerSecond) / 1e9;
+					const double flCyclesPerByte = flTicks / static_cast<double>(nSize);
+
+					std::printf("%-16s %-7s %-10s %10zu %10.3f %10.3f\n", algorithm.szName, arrOverloadNames[nOverload], arrAlignmentNames[nAlignment], nSize, flGigabytesPerSecond, flCyclesPerByte);
+					if (hCSV != nullptr)
+						std::fprintf(hCSV, "throughput,%s,%s,%s,%zu,%.6f,%.6f,,,\n", algorithm.szName, arrOverloadNames[nOverload], arrAlignmentNames[nAlignment], nSize, flGigabytesPerSecond, flCyclesPerByte);
+				}
+			}
+		}
+	}
+
+	std::printf("\n%-16s %-7s %10s %10s %10s %10s\n", "algorithm", "input", "size", "p50", "p90", "p99");
+
+	for (const Algorithm_t& algorithm : arrAlgorithms)
+	{
+		if (options.szFilter != nullptr && std::strstr(algorithm.szName, options.szFilter) == nullptr)
+			continue;
+
+		for (const std::size_t nSize : arrLatencySizes)
+		{
+			if (nSize > options.nMaxSize)
+				break;
+
+			for (int nOverload = 0; nOverload < OVERLOAD_MAX; ++nOverload)
+			{
+				std::uint8_t* pKey = arrKeys[0];
+
+				const std::uint8_t uTerminated = pKey[nSize];
+				pKey[nSize] = '\0';
+
+				const Latency_t latency = algorithm.pfnMeasureLatency(pKey, nSize, static_cast<EOverload>(nOverload), options.nSamples, flTimerOverhead);
+				pKey[nSize] = uTerminated;
+
+				std::printf("%-16s %-7s %10zu %10.1f %10.1f %10.1f\n", algorithm.szName, arrOverloadNames[nOverload], nSize, latency.flMedian, latency.flNinetieth, latency.flNinetyNinth);
+				if (hCSV != nullptr)
+					std::fprintf(hCSV, "latency,%s,%s,aligned,%zu,,,%.2f,%.2f,%.2f\n", algorithm.szName, arrOverloadNames[nOverload], nSize, latency.flMedian, latency.flNinetieth, latency.flNinetyNinth);
+			}
+		}
+	}
+
+	if (hCSV != nullptr)
+		std::fclose(hCSV);
+
+	return 0;
+}
@@ -0,0 +1,24 @@
+// separate translation unit for the 'Q_HASH_CRC32_NO_LUT' variant, since the option changes the definitions of the 'CRC32' namespace and can't be mixed with the default one
+// the namespace is renamed to keep both variants in the one program without violating the one definition rule, and the literals that are defined outside of it with the same name are omitted
+#ifndef Q_HAS_INCLUDE
+#define Q_HAS_INCLUDE(HEADER) __has_include(HEADER)
+#endif
+
+#define Q_HASH_CRC32_NO_LUT
+#define Q_HASH_NO_LITERALS
+#define CRC32 CRC32_NOLUT
+#include "../crc32.h"
+#undef CRC32
+
+namespace BENCHMARK
+{
+	std::uint64_t HashCRC32NoLUT(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+	{
+		return CRC32_NOLUT::Hash(pSource, nLength);
+	}
+
+	std::uint64_t HashCRC32NoLUT(const char* szSource) noexcept
+	{
+		return CRC32_NOLUT::Hash(szSource);
+	}
+}
@@ -0,0 +1,563 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] memcpy, memset
+#include <cstring>
+// used: [stl] rotl
+#include <bit>
+// used: [stl] operator new, align_val_t
+#include <new>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_integral_v
+#include <type_traits>
+// used: [stl] exchange
+#include <utility>
+
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch, prefetch
+#include "simd.h"
+
+#if !defined(Q_HASH_BLOOM_FILTER_NO_AVX2) && defined(Q_HASH_CPU_X86)
+#define Q_HASH_BLOOM_FILTER_AVX2
+#endif
+
+#define Q_HASH_BLOOM_FILTER
+
+/*
+ * CACHE-BLOCKED BLOOM FILTER
+ * @note: the high bits of the key's hash select the 64-byte block, then each of its 8 words gets one probe that is derived by the double hashing, so any operation touches the single cache line and the block is tested at once
+ * the 64-bit hash gives the 32 bits of its low half as the first hash and its high half, that also selects the block, rotated by 16 bits as the step, the 128-bit one gives both from its low half; the hashes that don't avalanche are mixed beforehand and the narrower ones are rejected, since they couldn't spread the keys over the blocks
+ * @credits: Adam Kirsch, Michael Mitzenmacher - Less Hashing, Same Performance: Building a Better Bloom Filter; Felix Putze, Peter Sanders, Johannes Singler - Cache-, Hash- and Space-Efficient Bloom Filters
+ */
+namespace Q_HASH
+{
+	namespace DETAIL
+	{
+		// bytes of the block that holds all probes of the key, equal to the cache line
+		inline constexpr std::size_t nBloomBlockSize = 64U;
+		// count of the words of the block, each is probed once per key
+		inline constexpr std::size_t nBloomBlockWords = nBloomBlockSize / sizeof(std::uint64_t);
+		// count of the keys which blocks are requested at once by the batched operations
+		inline constexpr std::size_t nBloomBatchWindow = 16U;
+		// 'QBLM' in the little-endian order
+		inline constexpr std::uint32_t uBloomMagic = 0x4D4C4251;
+		inline constexpr std::uint32_t uBloomVersion = 2U;
+
+		/// header of the serialized filter, padded to the block size so the blocks stay aligned at the page-aligned mapping
+		struct BloomHeader_t
+		{
+			std::uint32_t uMagic;
+			std::uint32_t uVersion;
+			std::uint64_t ullBlockCount;
+			// size of the hash the filter was built from, since the hashes of different widths are split differently
+			std::uint32_t uHashSize;
+			std::uint32_t uSeed;
+			std::uint8_t arrReserved[40];
+		};
+		static_assert(sizeof(BloomHeader_t) == nBloomBlockSize);
+
+		/// @param[in] uHashSize size of the hash the reading filter is built from
+		/// @param[out] header header of the serialized filter
+		/// @returns: true if the data is the filter serialized with the hash of the same size and holds all its blocks, false otherwise
+		inline bool ReadBloomHeader(const void* pData, const std::size_t nSize, const std::uint32_t uHashSize, BloomHeader_t& header) noexcept
+		{
+			if (pData == nullptr || nSize < sizeof(BloomHeader_t))
+				return false;
+
+			std::memcpy(&header, pData, sizeof(BloomHeader_t));
+			return header.uMagic == uBloomMagic && header.uVersion == uBloomVersion && header.uHashSize == uHashSize && header.ullBlockCount != 0U && header.ullBlockCount <= (nSize - sizeof(BloomHeader_t)) / nBloomBlockSize;
+		}
+
+		// odd multipliers of each word's double hash, that spread all its bits into the highest ones, otherwise the probes of two keys would coincide in every word whenever just the high bits of their hashes do
+		alignas(32) inline constexpr std::uint32_t arrBloomSalts[nBloomBlockWords] = { 0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31 };
+
+		struct BloomProbe_t
+		{
+			// index of the first word of the block
+			std::size_t nWord;
+			std::uint32_t uFirst;
+			std::uint32_t uSecond;
+		};
+
+		/// @returns: 64 bits of the hash with all of them avalanched, so the block selector and the probes are independent
+		template <typename TAlgorithm>
+		constexpr std::uint64_t BloomPrepareHash(std::uint64_t ullHash) noexcept
+		{
+			// high bits of the multiplicative hashes, e.g. FNV1A, that select the block, depend on the last bytes too weakly
+			if constexpr (!TAlgorithm::bAvalanching)
+			{
+				ullHash ^= ullHash >> 33U;
+				ullHash *= 0xFF51AFD7ED558CCD;
+				ullHash ^= ullHash >> 33U;
+				ullHash *= 0xC4CEB9FE1A85EC53;
+				ullHash ^= ullHash >> 33U;
+			}
+
+			return ullHash;
+		}
+
+		/// split the key's hash into the block selector and the two hashes the probes are derived from
+		template <typename TAlgorithm>
+		constexpr BloomProbe_t MakeBloomProbe(const typename TAlgorithm::Hash_t& hash, const std::size_t nBlockCount) noexcept
+		{
+			std::uint32_t uSelector, uFirst, uSecond;
+
+			if constexpr (std::is_integral_v<typename TAlgorithm::Hash_t>)
+			{
+				const std::uint64_t ullHash = BloomPrepareHash<TAlgorithm>(static_cast<std::uint64_t>(hash));
+				uSelector = static_cast<std::uint32_t>(ullHash >> 32U);
+				uFirst = static_cast<std::uint32_t>(ullHash);
+				// the highest bits already select the block, so they're rotated down to keep the probe stride unrelated to it
+				uSecond = std::rotl(uSelector, 16);
+			}
+			else
+			{
+				const std::uint64_t ullLow = BloomPrepareHash<TAlgorithm>(hash.ullLow);
+				uSelector = static_cast<std::uint32_t>(BloomPrepareHash<TAlgorithm>(hash.ullHigh) >> 32U);
+				uFirst = static_cast<std::uint32_t>(ullLow);
+				uSecond = static_cast<std::uint32_t>(ullLow >> 32U);
+			}
+
+			// multiply-shift range reduction, that avoids the division
+			const std::size_t nBlock = static_cast<std::size_t>((static_cast<std::uint64_t>(uSelector) * nBlockCount) >> 32U);
+			return { nBlock * nBloomBlockWords, uFirst, uSecond };
+		}
+
+		/* @section: kernels */
+		/// portable probing of the block word by word
+		struct BloomKernelScalar_t
+		{
+			/// @returns: bit of the probe in the given word of the block
+			static std::uint64_t GetProbeBit(const BloomProbe_t& probe, const std::uint32_t i) noexcept
+			{
+				return 1ULL << (((probe.uFirst + i * probe.uSecond) * arrBloomSalts[i]) >> 26U);
+			}
+
+			static void Insert(std::uint64_t* pBlocks, const BloomProbe_t* pProbes, const std::size_t nCount) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+				{
+					std::uint64_t* pBlock = pBlocks + pProbes[i].nWord;
+					for (std::uint32_t j = 0U; j < nBloomBlockWords; ++j)
+						pBlock[j] |= GetProbeBit(pProbes[i], j);
+				}
+			}
+
+			static void Contains(const std::uint64_t* pBlocks, const BloomProbe_t* pProbes, const std::size_t nCount, bool* pResults) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+				{
+					const std::uint64_t* pBlock = pBlocks + pProbes[i].nWord;
+
+					std::uint64_t ullMissing = 0U;
+					for (std::uint32_t j = 0U; j < nBloomBlockWords; ++j)
+						ullMissing |= GetProbeBit(pProbes[i], j) & ~pBlock[j];
+
+					pResults[i] = (ullMissing == 0U);
+				}
+			}
+		};
+
+	#ifdef Q_HASH_BLOOM_FILTER_AVX2
+		/// probing of the whole block by the two vectors
+		struct BloomKernelAVX2_t
+		{
+			/// @param[out] ymmLow probe bits of the first half of the block
+			/// @param[out] ymmHigh probe bits of the second half of the block
+			Q_HASH_TARGET("avx2") static void MakeMasks(const BloomProbe_t& probe, __m256i& ymmLow, __m256i& ymmHigh) noexcept
+			{
+				const __m256i ymmHashes = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(probe.uFirst)), _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(probe.uSecond)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+				const __m256i ymmShifts = _mm256_srli_epi32(_mm256_mullo_epi32(ymmHashes, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrBloomSalts))), 26);
+				const __m256i ymmOne = _mm256_set1_epi64x(1);
+
+				ymmLow = _mm256_sllv_epi64(ymmOne, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(ymmShifts)));
+				ymmHigh = _mm256_sllv_epi64(ymmOne, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(ymmShifts, 1)));
+			}
+
+			Q_HASH_TARGET("avx2") static void Insert(std::uint64_t* pBlocks, const BloomProbe_t* pProbes, const std::size_t nCount) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+				{
+					__m256i ymmLow, ymmHigh;
+					MakeMasks(pProbes[i], ymmLow, ymmHigh);
+
+					__m256i* pBlock = reinterpret_cast<__m256i*>(pBlocks + pProbes[i].nWord);
+					_mm256_store_si256(pBlock, _mm256_or_si256(_mm256_load_si256(pBlock), ymmLow));
+					_mm256_store_si256(pBlock + 1, _mm256_or_si256(_mm256_load_si256(pBlock + 1), ymmHigh));
+				}
+			}
+
+			Q_HASH_TARGET("avx2") static void Contains(const std::uint64_t* pBlocks, const BloomProbe_t* pProbes, const std::size_t nCount, bool* pResults) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+				{
+					__m256i ymmLow, ymmHigh;
+					MakeMasks(pProbes[i], ymmLow, ymmHigh);
+
+					// carry flag is set when all bits of the mask are set in the block
+					const __m256i* pBlock = reinterpret_cast<const __m256i*>(pBlocks + pProbes[i].nWord);
+					pResults[i] = (_mm256_testc_si256(_mm256_load_si256(pBlock), ymmLow) & _mm256_testc_si256(_mm256_load_si256(pBlock + 1), ymmHigh)) != 0;
+				}
+			}
+		};
+	#endif
+
+		/// split the batch into the windows, where the blocks of all keys of the window are requested before the first one is probed, so the cache misses overlap
+		template <typename TKernel, typename TAlgorithm>
+		void BloomInsertBatch(std::uint64_t* pBlocks, const std::size_t nBlockCount, const typename TAlgorithm::Hash_t* pHashes, const std::size_t nCount) noexcept
+		{
+			BloomProbe_t arrProbes[nBloomBatchWindow];
+
+			for (std::size_t nOffset = 0U; nOffset < nCount; nOffset += nBloomBatchWindow)
+			{
+				const std::size_t nWindow = (nCount - nOffset < nBloomBatchWindow) ? nCount - nOffset : nBloomBatchWindow;
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+				{
+					arrProbes[i] = MakeBloomProbe<TAlgorithm>(pHashes[nOffset + i], nBlockCount);
+					SIMD::Prefetch(pBlocks + arrProbes[i].nWord);
+				}
+
+				TKernel::Insert(pBlocks, arrProbes, nWindow);
+			}
+		}
+
+		template <typename TKernel, typename TAlgorithm>
+		void BloomContainsBatch(const std::uint64_t* pBlocks, const std::size_t nBlockCount, const typename TAlgorithm::Hash_t* pHashes, const std::size_t nCount, bool* pResults) noexcept
+		{
+			BloomProbe_t arrProbes[nBloomBatchWindow];
+
+			for (std::size_t nOffset = 0U; nOffset < nCount; nOffset += nBloomBatchWindow)
+			{
+				const std::size_t nWindow = (nCount - nOffset < nBloomBatchWindow) ? nCount - nOffset : nBloomBatchWindow;
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+				{
+					arrProbes[i] = MakeBloomProbe<TAlgorithm>(pHashes[nOffset + i], nBlockCount);
+					SIMD::Prefetch(pBlocks + arrProbes[i].nWord);
+				}
+
+				TKernel::Contains(pBlocks, arrProbes, nWindow, pResults + nOffset);
+			}
+		}
+
+		/* @section: dispatch */
+		template <typename TAlgorithm>
+		using BloomInsertBatch_t = void(std::uint64_t*, std::size_t, const typename TAlgorithm::Hash_t*, std::size_t) noexcept;
+		template <typename TAlgorithm>
+		using BloomContainsBatch_t = void(const std::uint64_t*, std::size_t, const typename TAlgorithm::Hash_t*, std::size_t, bool*) noexcept;
+
+	#ifdef Q_HASH_BLOOM_FILTER_AVX2
+		template <typename TAlgorithm>
+		inline BloomInsertBatch_t<TAlgorithm>* ResolveBloomInsertBatch() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &BloomInsertBatch<BloomKernelAVX2_t, TAlgorithm>;
+
+			return &BloomInsertBatch<BloomKernelScalar_t, TAlgorithm>;
+		}
+
+		template <typename TAlgorithm>
+		inline BloomContainsBatch_t<TAlgorithm>* ResolveBloomContainsBatch() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &BloomContainsBatch<BloomKernelAVX2_t, TAlgorithm>;
+
+			return &BloomContainsBatch<BloomKernelScalar_t, TAlgorithm>;
+		}
+
+		template <typename TAlgorithm>
+		using BloomInsertBatchDispatch_t = Q_HASH::CPU::CDispatch<BloomInsertBatch_t<TAlgorithm>, &ResolveBloomInsertBatch<TAlgorithm>>;
+		template <typename TAlgorithm>
+		using BloomContainsBatchDispatch_t = Q_HASH::CPU::CDispatch<BloomContainsBatch_t<TAlgorithm>, &ResolveBloomContainsBatch<TAlgorithm>>;
+	#endif
+	}
+
+	/// read-only filter over the blocks it doesn't own, e.g. the serialized filter mapped from the file
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM' the keys are hashed by, either 64-bit or 128-bit, e.g. 'Q_HASH::ALGORITHM::MURMUR2_64'
+	template <typename TAlgorithm>
+	class CBloomFilterView
+	{
+	public:
+		using Hash_t = typename TAlgorithm::Hash_t;
+		// the high bits of the narrower hashes are zero, that would put every key into the first block
+		static_assert(sizeof(Hash_t) >= sizeof(std::uint64_t), "Bloom filter requires either 64-bit or 128-bit hash");
+
+		constexpr CBloomFilterView() noexcept = default;
+
+		/// @param[in] pBlocks blocks of the filter, aligned to their size
+		/// @param[in] nBlockCount count of the blocks
+		/// @param[in] uSeed seed the keys are hashed with
+		constexpr CBloomFilterView(const std::uint64_t* pBlocks, const std::size_t nBlockCount, const std::uint32_t uSeed) noexcept :
+			pBlocks(pBlocks), nBlockCount(nBlockCount), uSeed(uSeed) { }
+
+		/// @param[in] pData serialized filter, aligned to the block size, e.g. mapped from the file
+		/// @param[in] nSize size of the data in bytes
+		/// @returns: view over the blocks of the serialized filter in-place, or the empty view if the data isn't the filter serialized with the same hash
+		[[nodiscard]] static CBloomFilterView FromMemory(const void* pData, const std::size_t nSize) noexcept
+		{
+			// the blocks are read by the aligned loads
+			DETAIL::BloomHeader_t header;
+			if ((reinterpret_cast<std::uintptr_t>(pData) & (DETAIL::nBloomBlockSize - 1U)) != 0U || !DETAIL::ReadBloomHeader(pData, nSize, sizeof(Hash_t), header))
+				return { };
+
+			return { reinterpret_cast<const std::uint64_t*>(static_cast<const std::uint8_t*>(pData) + sizeof(DETAIL::BloomHeader_t)), static_cast<std::size_t>(header.ullBlockCount), header.uSeed };
+		}
+
+		/* @section: get */
+		/// @returns: false if the view has no blocks, then it never contains anything
+		[[nodiscard]] bool IsValid() const noexcept
+		{
+			return nBlockCount != 0U;
+		}
+
+		/// @returns: size of the filter in bytes
+		[[nodiscard]] std::size_t Size() const noexcept
+		{
+			return nBlockCount * DETAIL::nBloomBlockSize;
+		}
+
+		/// @returns: hash of the key, as it is used by the filter
+		[[nodiscard]] Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength) const noexcept
+		{
+			return TAlgorithm::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @returns: false if the key has never been inserted, true if it probably has
+		[[nodiscard]] bool Contains(const std::uint8_t* pSource, const std::size_t nLength) const noexcept
+		{
+			return ContainsHash(Hash(pSource, nLength));
+		}
+
+		[[nodiscard]] bool Contains(const std::string_view strKey) const noexcept
+		{
+			return ContainsHash(Hash(reinterpret_cast<const std::uint8_t*>(strKey.data()), strKey.size()));
+		}
+
+		/// @param[in] hash precomputed hash of the key, must be equal to the one the 'Hash' returns
+		/// @returns: false if the key has never been inserted, true if it probably has
+		[[nodiscard]] bool ContainsHash(const Hash_t& hash) const noexcept
+		{
+			bool bResult = false;
+			ContainsHashBatch(&hash, 1U, &bResult);
+			return bResult;
+		}
+
+		/// test many keys at once, faster than testing them one by one
+		/// @param[in] pHashes array of the precomputed hashes of each key
+		/// @param[in] nCount count of the keys
+		/// @param[out] pResults array that receives false for each key that has never been inserted, true for the one that probably has
+		void ContainsHashBatch(const Hash_t* pHashes, const std::size_t nCount, bool* pResults) const noexcept
+		{
+			if (nBlockCount == 0U)
+			{
+				std::memset(pResults, 0, nCount * sizeof(bool));
+				return;
+			}
+
+		#ifdef Q_HASH_BLOOM_FILTER_AVX2
+			DETAIL::BloomContainsBatchDispatch_t<TAlgorithm>::Call(pBlocks, nBlockCount, pHashes, nCount, pResults);
+		#else
+			DETAIL::BloomContainsBatch<DETAIL::BloomKernelScalar_t, TAlgorithm>(pBlocks, nBlockCount, pHashes, nCount, pResults);
+		#endif
+		}
+
+	private:
+		const std::uint64_t* pBlocks = nullptr;
+		std::size_t nBlockCount = 0U;
+		std::uint32_t uSeed = 0U;
+	};
+
+	/// probabilistic set of the keys, that answers whether the key has never been inserted without false negatives
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM' the keys are hashed by, either 64-bit or 128-bit, e.g. 'Q_HASH::ALGORITHM::MURMUR2_64'
+	template <typename TAlgorithm>
+	class CBloomFilter
+	{
+	public:
+		using Hash_t = typename TAlgorithm::Hash_t;
+		static_assert(sizeof(Hash_t) >= sizeof(std::uint64_t), "Bloom filter requires either 64-bit or 128-bit hash");
+		using View_t = CBloomFilterView<TAlgorithm>;
+
+		/// @param[in] nExpectedCount count of the keys to size the filter for
+		/// @param[in] nBitsPerKey bits of memory per each expected key, gives about 1% of false positives for 10, 0.4% for 12 and 0.1% for 16
+		/// @param[in] uSeed seed the keys are hashed with
+		explicit CBloomFilter(const std::size_t nExpectedCount, const std::size_t nBitsPerKey = 12U, const std::uint32_t uSeed = 0U) :
+			uSeed(uSeed)
+		{
+			const std::size_t nBlockBits = DETAIL::nBloomBlockSize * 8U;
+			Allocate((nExpectedCount * nBitsPerKey + nBlockBits - 1U) / nBlockBits);
+		}
+
+		~CBloomFilter()
+		{
+			Destroy();
+		}
+
+		CBloomFilter(const CBloomFilter&) = delete;
+		CBloomFilter& operator=(const CBloomFilter&) = delete;
+
+		CBloomFilter(CBloomFilter&& other) noexcept :
+			pBlocks(std::exchange(other.pBlocks, nullptr)), nBlockCount(std::exchange(other.nBlockCount, 0U)), uSeed(other.uSeed) { }
+
+		CBloomFilter& operator=(CBloomFilter&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Destroy();
+				pBlocks = std::exchange(other.pBlocks, nullptr);
+				nBlockCount = std::exchange(other.nBlockCount, 0U);
+				uSeed = other.uSeed;
+			}
+
+			return *this;
+		}
+
+		/* @section: get */
+		/// @returns: read-only view of the filter, valid until it is destroyed or replaced
+		[[nodiscard]] View_t View() const noexcept
+		{
+			return { pBlocks, nBlockCount, uSeed };
+		}
+
+		/// @returns: size of the filter in bytes
+		[[nodiscard]] std::size_t Size() const noexcept
+		{
+			return nBlockCount * DETAIL::nBloomBlockSize;
+		}
+
+		/// @returns: hash of the key, as it is used by the filter
+		[[nodiscard]] Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength) const noexcept
+		{
+			return TAlgorithm::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @returns: false if the key has never been inserted, true if it probably has
+		[[nodiscard]] bool Contains(const std::uint8_t* pSource, const std::size_t nLength) const noexcept
+		{
+			return View().Contains(pSource, nLength);
+		}
+
+		[[nodiscard]] bool Contains(const std::string_view strKey) const noexcept
+		{
+			return View().Contains(strKey);
+		}
+
+		/// @param[in] hash precomputed hash of the key, must be equal to the one the 'Hash' returns
+		[[nodiscard]] bool ContainsHash(const Hash_t& hash) const noexcept
+		{
+			return View().ContainsHash(hash);
+		}
+
+		/// test many keys at once, faster than testing them one by one
+		/// @param[in] pHashes array of the precomputed hashes of each key
+		/// @param[in] nCount count of the keys
+		/// @param[out] pResults array that receives false for each key that has never been inserted, true for the one that probably has
+		void ContainsHashBatch(const Hash_t* pHashes, const std::size_t nCount, bool* pResults) const noexcept
+		{
+			View().ContainsHashBatch(pHashes, nCount, pResults);
+		}
+
+		/* @section: set */
+		void Insert(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+		{
+			InsertHash(Hash(pSource, nLength));
+		}
+
+		void Insert(const std::string_view strKey) noexcept
+		{
+			InsertHash(Hash(reinterpret_cast<const std::uint8_t*>(strKey.data()), strKey.size()));
+		}
+
+		/// @param[in] hash precomputed hash of the key, must be equal to the one the 'Hash' returns
+		void InsertHash(const Hash_t& hash) noexcept
+		{
+			InsertHashBatch(&hash, 1U);
+		}
+
+		/// insert many keys at once, faster than inserting them one by one
+		/// @param[in] pHashes array of the precomputed hashes of each key
+		/// @param[in] nCount count of the keys
+		void InsertHashBatch(const Hash_t* pHashes, const std::size_t nCount) noexcept
+		{
+		#ifdef Q_HASH_BLOOM_FILTER_AVX2
+			DETAIL::BloomInsertBatchDispatch_t<TAlgorithm>::Call(pBlocks, nBlockCount, pHashes, nCount);
+		#else
+			DETAIL::BloomInsertBatch<DETAIL::BloomKernelScalar_t, TAlgorithm>(pBlocks, nBlockCount, pHashes, nCount);
+		#endif
+		}
+
+		/// remove all keys
+		void Clear() noexcept
+		{
+			if (pBlocks != nullptr)
+				std::memset(pBlocks, 0, Size());
+		}
+
+		/* @section: serialization */
+		/// @returns: size of the serialized filter in bytes
+		[[nodiscard]] std::size_t SerializedSize() const noexcept
+		{
+			return sizeof(DETAIL::BloomHeader_t) + Size();
+		}
+
+		/// write the filter in the form that can be mapped back and queried in-place by 'CBloomFilterView::FromMemory', the words are stored in the native byte order
+		/// @param[out] pDestination buffer of at least 'SerializedSize()' bytes
+		void Serialize(void* pDestination) const noexcept
+		{
+			DETAIL::BloomHeader_t header = { };
+			header.uMagic = DETAIL::uBloomMagic;
+			header.uVersion = DETAIL::uBloomVersion;
+			header.ullBlockCount = nBlockCount;
+			header.uHashSize = sizeof(Hash_t);
+			header.uSeed = uSeed;
+
+			std::memcpy(pDestination, &header, sizeof(DETAIL::BloomHeader_t));
+			if (pBlocks != nullptr)
+				std::memcpy(static_cast<std::uint8_t*>(pDestination) + sizeof(DETAIL::BloomHeader_t), pBlocks, Size());
+		}
+
+		/// replace the filter with the copy of the serialized one
+		/// @param[in] pData serialized filter
+		/// @param[in] nSize size of the data in bytes
+		/// @returns: true if the filter has been loaded, false if the data isn't the filter serialized with the same hash
+		bool Deserialize(const void* pData, const std::size_t nSize)
+		{
+			DETAIL::BloomHeader_t header;
+			if (!DETAIL::ReadBloomHeader(pData, nSize, sizeof(Hash_t), header))
+				return false;
+
+			Destroy();
+			Allocate(static_cast<std::size_t>(header.ullBlockCount));
+			std::memcpy(pBlocks, static_cast<const std::uint8_t*>(pData) + sizeof(DETAIL::BloomHeader_t), Size());
+			uSeed = header.uSeed;
+			return true;
+		}
+
+	private:
+		void Allocate(std::size_t nNewBlockCount)
+		{
+			if (nNewBlockCount == 0U)
+				nNewBlockCount = 1U;
+
+			pBlocks = static_cast<std::uint64_t*>(::operator new(nNewBlockCount * DETAIL::nBloomBlockSize, std::align_val_t(DETAIL::nBloomBlockSize)));
+			nBlockCount = nNewBlockCount;
+			Clear();
+		}
+
+		void Destroy() noexcept
+		{
+			if (pBlocks == nullptr)
+				return;
+
+			::operator delete(pBlocks, std::align_val_t(DETAIL::nBloomBlockSize));
+			pBlocks = nullptr;
+			nBlockCount = 0U;
+		}
+
+		std::uint64_t* pBlocks = nullptr;
+		std::size_t nBlockCount = 0U;
+		std::uint32_t uSeed = 0U;
+	};
+}
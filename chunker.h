@@ -0,0 +1,238 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] memcpy, memmove
+#include <cstring>
+// used: [stl] array
+#include <array>
+// used: [stl] bit_width
+#include <bit>
+// used: [stl] is_void_v
+#include <type_traits>
+// used: [stl] vector
+#include <vector>
+
+// used: CRabinKarp, CBuzHash, CGear
+#include "rolling.h"
+
+#define Q_HASH_CHUNKER
+
+/*
+ * CONTENT-DEFINED CHUNKING OF THE BYTE STREAM
+ * @note: the stream is cut where the rolling hash of the last bytes hits the mask, so the boundaries depend only on the nearby content and the insertion or removal of the data changes only the chunks around it
+ * the search starts after the minimum length, uses the harder mask until the average length and the easier one after it to narrow the length distribution, and cuts unconditionally at the maximum length
+ * @credits: Wen Xia, Yukun Zhou, Hong Jiang et al. - FastCDC
+ */
+namespace Q_HASH
+{
+	/// content-defined chunk of the stream
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM' whose hash of the chunk bytes is reported, or 'void' to report the bounds only
+	template <typename TAlgorithm = void>
+	struct Chunk_t
+	{
+		// offset of the first byte from the stream begin
+		std::uint64_t ullOffset;
+		// count of bytes
+		std::size_t nLength;
+		// hash of the chunk bytes
+		typename TAlgorithm::Hash_t hash;
+	};
+
+	template <>
+	struct Chunk_t<void>
+	{
+		// offset of the first byte from the stream begin
+		std::uint64_t ullOffset;
+		// count of bytes
+		std::size_t nLength;
+	};
+
+	/// streaming splitter of the data into the content-defined chunks
+	/// @tparam TRolling any of the rolling hashes from 'Q_HASH::ROLLING'
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM' for the strong hash of each chunk, e.g. 'Q_HASH::CChunker<Q_HASH::ROLLING::CGear, Q_HASH::ALGORITHM::MURMUR2_64>', or 'void' to skip it
+	template <typename TRolling = ROLLING::CGear, typename TAlgorithm = void>
+	class CChunker
+	{
+		static constexpr bool bHasStrongHash = !std::is_void_v<TAlgorithm>;
+		static constexpr std::size_t nWindow = TRolling::nWindow;
+
+	public:
+		using Chunk_t = Q_HASH::Chunk_t<TAlgorithm>;
+
+		/// @param[in] nMinLength minimal length of the chunk, except the last one, must be at least the window of the rolling hash
+		/// @param[in] nAverageLength expected length of the chunk, rounded down to the power of two, must be in range [nMinLength, nMaxLength]
+		/// @param[in] nMaxLength maximal length of the chunk
+		/// @param[in] uSeed seed of the strong hash generation
+		explicit CChunker(const std::size_t nMinLength = 2048U, const std::size_t nAverageLength = 8192U, const std::size_t nMaxLength = 65536U, const std::uint32_t uSeed = 0U) :
+			nMinLength(nMinLength < nWindow ? nWindow : nMinLength), nAverageLength(nAverageLength), nMaxLength(nMaxLength), uSeed(uSeed)
+		{
+			// normalization by two bits in each direction from the average
+			const unsigned int nAverageBits = static_cast<unsigned int>(std::bit_width(nAverageLength)) - 1U;
+			ullHardMask = MakeMask(nAverageBits + 2U);
+			ullEasyMask = MakeMask(nAverageBits > 2U ? nAverageBits - 2U : 1U);
+
+			if constexpr (bHasStrongHash)
+				vecPending.reserve(nMaxLength);
+		}
+
+		/// feed the next part of the stream, reporting all chunks that end in it
+		/// @param[in] pSource pointer to the data
+		/// @param[in] nLength count of bytes in the data
+		/// @param[in] fnChunk callable that is invoked as 'fnChunk(const Chunk_t& chunk)' for each completed chunk in the stream order
+		template <typename TCallback>
+		void Update(const std::uint8_t* pSource, const std::size_t nLength, TCallback&& fnChunk)
+		{
+			// begin of the current chunk in the data, its bytes before it are in the previous parts
+			std::size_t nBegin = 0U;
+			std::size_t nPosition = 0U;
+
+			while (nPosition < nLength)
+			{
+				const std::size_t nChunkLength = nPendingLength + (nPosition - nBegin);
+				bool bCut = false;
+
+				if (nChunkLength < nMinLength - nWindow)
+					// bytes before the window of the first tested position are skipped
+					nPosition += Minimum(nMinLength - nWindow - nChunkLength, nLength - nPosition);
+				else if (nChunkLength < nMinLength)
+				{
+					for (const std::size_t nEnd = nPosition + Minimum(nMinLength - nChunkLength, nLength - nPosition); nPosition < nEnd; ++nPosition)
+						rolling.Append(pSource[nPosition]);
+				}
+				else if (nChunkLength < nAverageLength)
+					bCut = Scan(pSource, nPosition, nPosition + Minimum(nAverageLength - nChunkLength, nLength - nPosition), ullHardMask);
+				else if (nChunkLength < nMaxLength)
+					bCut = Scan(pSource, nPosition, nPosition + Minimum(nMaxLength - nChunkLength, nLength - nPosition), ullEasyMask);
+				else
+					bCut = true;
+
+				if (bCut)
+				{
+					Emit(pSource + nBegin, nPosition - nBegin, fnChunk);
+					nBegin = nPosition;
+				}
+			}
+
+			// keep the tail of the chunk that continues in the next part
+			if constexpr (bHasStrongHash)
+				vecPending.insert(vecPending.end(), pSource + nBegin, pSource + nLength);
+
+			nPendingLength += nLength - nBegin;
+			SaveHistory(pSource, nLength);
+		}
+
+		/// report the rest of the stream as the last chunk and begin the new stream
+		/// @param[in] fnChunk callable that is invoked as 'fnChunk(const Chunk_t& chunk)' for the last chunk, if the stream has any bytes left
+		template <typename TCallback>
+		void Final(TCallback&& fnChunk)
+		{
+			if (nPendingLength > 0U)
+				Emit(nullptr, 0U, fnChunk);
+
+			ullOffset = 0U;
+			arrHistory = { };
+		}
+
+	private:
+		static constexpr std::size_t Minimum(const std::size_t nFirst, const std::size_t nSecond) noexcept
+		{
+			return (nFirst < nSecond) ? nFirst : nSecond;
+		}
+
+		/// @returns: mask of given count of the highest bits
+		static constexpr std::uint64_t MakeMask(const unsigned int nBits) noexcept
+		{
+			return (nBits >= 64U) ? ~0ULL : ~(~0ULL >> nBits);
+		}
+
+		/// roll the window over the range of the data until the boundary is found
+		/// @param[in,out] nPosition position of the next byte to roll, moved either past the last byte of the chunk or to the end of the range
+		/// @returns: true if the boundary has been found, false otherwise
+		bool Scan(const std::uint8_t* pSource, std::size_t& nPosition, const std::size_t nEnd, const std::uint64_t ullMask) noexcept
+		{
+			std::size_t i = nPosition;
+
+			// oldest bytes of the window at the begin of the data are from the previous part
+			for (; i < nEnd && i < nWindow; ++i)
+			{
+				rolling.Roll(arrHistory[i], pSource[i]);
+
+				if ((rolling.Get() & ullMask) == 0U)
+				{
+					nPosition = i + 1U;
+					return true;
+				}
+			}
+
+			for (; i < nEnd; ++i)
+			{
+				rolling.Roll(pSource[i - nWindow], pSource[i]);
+
+				if ((rolling.Get() & ullMask) == 0U)
+				{
+					nPosition = i + 1U;
+					return true;
+				}
+			}
+
+			nPosition = nEnd;
+			return false;
+		}
+
+		/// report the chunk that ends with given bytes of the current part and begin the next one
+		template <typename TCallback>
+		void Emit(const std::uint8_t* pSource, const std::size_t nLength, TCallback& fnChunk)
+		{
+			Chunk_t chunk;
+			chunk.ullOffset = ullOffset;
+			chunk.nLength = nPendingLength + nLength;
+
+			if constexpr (bHasStrongHash)
+			{
+				// hash the chunk in-place while it's still in cache, or gather it when it has started in the previous part
+				if (vecPending.empty())
+					chunk.hash = TAlgorithm::Hash(pSource, nLength, uSeed);
+				else
+				{
+					vecPending.insert(vecPending.end(), pSource, pSource + nLength);
+					chunk.hash = TAlgorithm::Hash(vecPending.data(), vecPending.size(), uSeed);
+					vecPending.clear();
+				}
+			}
+
+			fnChunk(static_cast<const Chunk_t&>(chunk));
+
+			ullOffset += chunk.nLength;
+			nPendingLength = 0U;
+			rolling.Reset();
+		}
+
+		/// remember the last bytes of the stream, that leave the window at the begin of the next part
+		void SaveHistory(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+		{
+			if (nLength >= nWindow)
+				std::memcpy(arrHistory.data(), pSource + nLength - nWindow, nWindow);
+			else if (nLength > 0U)
+			{
+				std::memmove(arrHistory.data(), arrHistory.data() + nLength, nWindow - nLength);
+				std::memcpy(arrHistory.data() + nWindow - nLength, pSource, nLength);
+			}
+		}
+
+		TRolling rolling = { };
+		std::array<std::uint8_t, nWindow> arrHistory = { };
+		// bytes of the current chunk from the previous parts, gathered only for the strong hash
+		std::vector<std::uint8_t> vecPending = { };
+		std::uint64_t ullOffset = 0U;
+		// count of bytes of the current chunk in the previous parts
+		std::size_t nPendingLength = 0U;
+		std::size_t nMinLength;
+		std::size_t nAverageLength;
+		std::size_t nMaxLength;
+		std::uint64_t ullHardMask;
+		std::uint64_t ullEasyMask;
+		std::uint32_t uSeed;
+	};
+}
@@ -0,0 +1,138 @@
+#pragma once
+// used: [stl] uint32_t
+#include <cstdint>
+// used: [stl] atomic
+#include <atomic>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define Q_HASH_CPU_X86
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define Q_HASH_CPU_X64
+#endif
+
+#ifdef _MSC_VER
+// used: __cpuid, __cpuidex, _xgetbv
+#include <intrin.h>
+#else
+// used: __cpuid, __cpuid_count
+#include <cpuid.h>
+#endif
+#endif
+
+// enable instruction set extensions for a single kernel, so it can be compiled without global target flags and guarded by the run-time check instead
+#if defined(__GNUC__) || defined(__clang__)
+#define Q_HASH_TARGET(FEATURES) __attribute__((target(FEATURES)))
+#else
+#define Q_HASH_TARGET(FEATURES)
+#endif
+
+/*
+ * RUN-TIME CPU FEATURES DETECTION SHARED BY THE HARDWARE ACCELERATED KERNELS
+ */
+namespace Q_HASH::CPU
+{
+	enum EFeature : std::uint32_t
+	{
+		FEATURE_NONE = 0U,
+		FEATURE_PCLMUL = (1U << 0U),
+		FEATURE_SSE42 = (1U << 1U),
+		FEATURE_AVX2 = (1U << 2U),
+		// foundation and doubleword/quadword instructions
+		FEATURE_AVX512 = (1U << 3U),
+		FEATURE_AES = (1U << 4U)
+	};
+
+	namespace DETAIL
+	{
+		inline std::uint32_t DetectFeatures() noexcept
+		{
+			std::uint32_t uFeatures = FEATURE_NONE;
+
+		// report the bare CPU, so every dispatched entry point is bound to its portable kernel
+		#if defined(Q_HASH_CPU_X86) && !defined(Q_HASH_FORCE_SCALAR)
+			unsigned int arrRegisters[4] = { };
+		#ifdef _MSC_VER
+			__cpuid(reinterpret_cast<int*>(arrRegisters), 1);
+		#else
+			__cpuid(1, arrRegisters[0], arrRegisters[1], arrRegisters[2], arrRegisters[3]);
+		#endif
+
+			// ecx
+			if (arrRegisters[2] & (1U << 1U))
+				uFeatures |= FEATURE_PCLMUL;
+			if (arrRegisters[2] & (1U << 20U))
+				uFeatures |= FEATURE_SSE42;
+			if (arrRegisters[2] & (1U << 25U))
+				uFeatures |= FEATURE_AES;
+
+			// check does OS save the extended registers on context switch
+			if ((arrRegisters[2] & (1U << 27U)) == 0U)
+				return uFeatures;
+
+		#ifdef _MSC_VER
+			const std::uint64_t ullEnabledStates = _xgetbv(0);
+		#else
+			std::uint32_t uEnabledStatesLow, uEnabledStatesHigh;
+			__asm__ __volatile__("xgetbv" : "=a"(uEnabledStatesLow), "=d"(uEnabledStatesHigh) : "c"(0));
+			const std::uint64_t ullEnabledStates = (static_cast<std::uint64_t>(uEnabledStatesHigh) << 32U) | uEnabledStatesLow;
+		#endif
+
+		#ifdef _MSC_VER
+			__cpuidex(reinterpret_cast<int*>(arrRegisters), 7, 0);
+		#else
+			__cpuid_count(7, 0, arrRegisters[0], arrRegisters[1], arrRegisters[2], arrRegisters[3]);
+		#endif
+
+			// ebx, xmm and ymm states
+			if ((ullEnabledStates & 0x6) == 0x6 && (arrRegisters[1] & (1U << 5U)))
+				uFeatures |= FEATURE_AVX2;
+			// ebx, xmm, ymm, opmask and zmm states
+			if ((ullEnabledStates & 0xE6) == 0xE6 && (arrRegisters[1] & (1U << 16U)) && (arrRegisters[1] & (1U << 17U)))
+				uFeatures |= FEATURE_AVX512;
+		#endif
+
+			return uFeatures;
+		}
+	}
+
+	/* @section: get */
+	/// @param[in] uFeatures bitwise combination of the 'EFeature' flags to test
+	/// @returns: true if all the given features are supported by the executing CPU, false otherwise
+	inline bool HasFeatures(const std::uint32_t uFeatures) noexcept
+	{
+		// detect only once per process
+		static const std::uint32_t uSupportedFeatures = DETAIL::DetectFeatures();
+		return (uSupportedFeatures & uFeatures) == uFeatures;
+	}
+
+	/* @section: dispatch */
+	template <typename TFunction, TFunction* (*pfnResolve)() noexcept>
+	class CDispatch;
+
+	/// entry point, that is bound to the best kernel for the executing CPU on its first call, then calls it through the cached pointer without any feature checks
+	/// @note: pointer is constant-initialized with the resolving trampoline, so the entry point is usable even from the static initializers of the other translation units
+	/// @param[in] pfnResolve function that picks the kernel for the detected features
+	template <typename TReturn, typename... TArgs, TReturn (*(*pfnResolve)() noexcept)(TArgs...) noexcept>
+	class CDispatch<TReturn(TArgs...) noexcept, pfnResolve>
+	{
+	public:
+		using Function_t = TReturn(TArgs...) noexcept;
+
+		static TReturn Call(TArgs... args) noexcept
+		{
+			// relaxed load compiles to the plain move, the concurrent first calls may resolve twice but always store the same kernel
+			return pfnKernel.load(std::memory_order_relaxed)(args...);
+		}
+
+	private:
+		static TReturn Resolve(TArgs... args) noexcept
+		{
+			Function_t* pfnResolved = pfnResolve();
+			pfnKernel.store(pfnResolved, std::memory_order_relaxed);
+			return pfnResolved(args...);
+		}
+
+		static inline std::atomic<Function_t*> pfnKernel = &Resolve;
+	};
+}
@@ -0,0 +1,578 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t, uintptr_t
+#include <cstdint>
+// used: [stl] array
+#include <array>
+// used: [stl] endian
+#include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] conditional_t, is_constant_evaluated
+#include <type_traits>
+
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch
+#include "cpu.h"
+
+#ifdef Q_HASH_CPU_X86
+// used: [intrin] _mm_clmulepi64_si128, sse2
+#include <wmmintrin.h>
+#endif
+
+// the multi-threaded generation is left out only when every algorithm that provides it has opted out, so the STL threads aren't pulled in then
+#if !defined(Q_HASH_CRC32_NO_PARALLEL) || !defined(Q_HASH_CRC64_NO_PARALLEL)
+// used: [stl] thread
+#include <thread>
+// used: [stl] vector
+#include <vector>
+
+#define Q_HASH_CRC_PARALLEL
+#endif
+
+#define Q_HASH_CRC
+
+/*
+ * CYCLIC REDUNDANCY CHECK OF ANY WIDTH UP TO 64 BITS
+ * @note: parameters follow the rocksoft model the same way as the CRC catalogues list them, i.e. polynomial and initial value are given in the normal form regardless of the reflection, and the output is reflected together with the input
+ */
+namespace Q_HASH::CRC
+{
+	/// smallest unsigned integral type that holds the CRC of the given width
+	template <unsigned int WIDTH>
+	using Register_t = std::conditional_t<(WIDTH <= 8U), std::uint8_t, std::conditional_t<(WIDTH <= 16U), std::uint16_t, std::conditional_t<(WIDTH <= 32U), std::uint32_t, std::uint64_t>>>;
+
+	namespace DETAIL
+	{
+		/// @returns: low 'nBits' bits of the value in the reversed order
+		constexpr std::uint64_t Reflect(const std::uint64_t ullValue, const unsigned int nBits) noexcept
+		{
+			std::uint64_t ullResult = 0ULL;
+
+			for (unsigned int i = 0U; i < nBits; ++i)
+			{
+				if (ullValue & (1ULL << i))
+					ullResult |= 1ULL << (nBits - 1U - i);
+			}
+
+			return ullResult;
+		}
+
+		/// @returns: mask of the low 'nBits' bits
+		constexpr std::uint64_t MakeMask(const unsigned int nBits) noexcept
+		{
+			return (nBits >= 64U) ? ~0ULL : (1ULL << nBits) - 1ULL;
+		}
+
+		/// @returns: endian-independent load of 4 bytes
+		inline std::uint32_t LoadBlock(const std::uint8_t* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+				return *reinterpret_cast<const std::uint32_t*>(pSource);
+			else
+				return (static_cast<std::uint32_t>(pSource[0]) | (static_cast<std::uint32_t>(pSource[1]) << 8U) | (static_cast<std::uint32_t>(pSource[2]) << 16U) | (static_cast<std::uint32_t>(pSource[3]) << 24U));
+		}
+
+		/// @returns: value with the reversed order of bytes
+		constexpr std::uint64_t ByteSwap(const std::uint64_t ullValue) noexcept
+		{
+			return (ullValue << 56U) | ((ullValue & 0xFF00) << 40U) | ((ullValue & 0xFF0000) << 24U) | ((ullValue & 0xFF000000) << 8U) | ((ullValue >> 8U) & 0xFF000000) | ((ullValue >> 24U) & 0xFF0000) | ((ullValue >> 40U) & 0xFF00) | (ullValue >> 56U);
+		}
+	}
+
+	/// table-driven CRC, which parameters are fixed at compile-time, so each instantiation gets its own tables and doesn't pay for the generality at run-time
+	/// @tparam WIDTH count of bits in the CRC, in range [1, 64]
+	/// @tparam POLYNOMIAL generator polynomial in the normal form, without the highest term
+	/// @tparam REFLECTED whether the bytes are processed from the lowest bit and the result is reflected
+	/// @tparam INITIAL initial value of the register in the normal form
+	/// @tparam XOR_OUTPUT value that is xored with the result
+	/// @tparam SLICE_BY 0 to calculate bitwise without any table, 1 to use the single table, 8 or 16 to process the blocks of that size with slicing tables
+	template <unsigned int WIDTH, std::uint64_t POLYNOMIAL, bool REFLECTED, std::uint64_t INITIAL, std::uint64_t XOR_OUTPUT, std::size_t SLICE_BY = 1U>
+	class CEngine
+	{
+		static_assert(WIDTH >= 1U && WIDTH <= 64U, "CRC width must be in range [1, 64]");
+		static_assert(SLICE_BY == 0U || SLICE_BY == 1U || SLICE_BY == 8U || SLICE_BY == 16U, "CRC slicing must be either 0, 1, 8 or 16");
+
+	public:
+		using Hash_t = Register_t<WIDTH>;
+
+	private:
+		/* @section: [internal] constants */
+		static constexpr unsigned int nRegisterBits = sizeof(Hash_t) * 8U;
+		// the reflected register keeps the CRC in its low bits and the normal one in its high bits, so the bits that meet the next input byte are always at the edge of it
+		static constexpr unsigned int nShift = REFLECTED ? 0U : nRegisterBits - WIDTH;
+		static constexpr std::uint64_t ullMask = DETAIL::MakeMask(WIDTH);
+		static constexpr Hash_t uPolynomial = static_cast<Hash_t>(REFLECTED ? DETAIL::Reflect(POLYNOMIAL & ullMask, WIDTH) : (POLYNOMIAL & ullMask) << nShift);
+
+		/// @returns: register advanced by the given byte, bit by bit
+		static constexpr Hash_t UpdateByteBitwise(Hash_t uState, const std::uint8_t uByte) noexcept
+		{
+			if constexpr (REFLECTED)
+			{
+				uState ^= uByte;
+				for (unsigned int i = 0U; i < 8U; ++i)
+					uState = static_cast<Hash_t>((uState >> 1U) ^ (uPolynomial & static_cast<Hash_t>(Hash_t(0U) - (uState & 1U))));
+			}
+			else
+			{
+				uState ^= static_cast<Hash_t>(static_cast<Hash_t>(uByte) << (nRegisterBits - 8U));
+				for (unsigned int i = 0U; i < 8U; ++i)
+					uState = static_cast<Hash_t>((uState << 1U) ^ (uPolynomial & static_cast<Hash_t>(Hash_t(0U) - (uState >> (nRegisterBits - 1U)))));
+			}
+
+			return uState;
+		}
+
+		/// @returns: lookup tables where the first one advances the register by the single byte and each next one advances the result of the previous one by one zero byte
+		static consteval auto MakeSlicingLookup()
+		{
+			constexpr std::size_t nTables = (SLICE_BY == 0U) ? 0U : ((SLICE_BY == 1U) ? 1U : SLICE_BY);
+			std::array<std::array<Hash_t, 256U>, nTables> arrTables;
+
+			for (std::size_t nSlice = 0U; nSlice < nTables; ++nSlice)
+			{
+				for (std::uint32_t uByte = 0U; uByte < 256U; ++uByte)
+					arrTables[nSlice][uByte] = (nSlice == 0U) ? UpdateByteBitwise(0U, static_cast<std::uint8_t>(uByte)) : UpdateByteBitwise(arrTables[nSlice - 1U][uByte], 0U);
+			}
+
+			return arrTables;
+		}
+
+		// pre-computed LUTs for the given parameters, the first one is the plain byte table
+		static constexpr auto arrLUT = MakeSlicingLookup();
+
+		/// @returns: register advanced by the given byte
+		static constexpr Hash_t UpdateByte(const Hash_t uState, const std::uint8_t uByte) noexcept
+		{
+			if constexpr (SLICE_BY == 0U)
+				return UpdateByteBitwise(uState, uByte);
+			else if constexpr (REFLECTED)
+				return static_cast<Hash_t>((static_cast<std::uint64_t>(uState) >> 8U) ^ arrLUT[0][(uState ^ uByte) & 0xFF]);
+			else
+				return static_cast<Hash_t>((static_cast<std::uint64_t>(uState) << 8U) ^ arrLUT[0][(uState >> (nRegisterBits - 8U)) ^ uByte]);
+		}
+
+		/// @returns: xored entries of the 4 consecutive tables, starting from the given one downwards, for the bytes of the word
+		static Hash_t LookupWord(const std::size_t nTable, const std::uint32_t uBlock) noexcept
+		{
+			return arrLUT[nTable][uBlock & 0xFF] ^ arrLUT[nTable - 1U][(uBlock >> 8U) & 0xFF] ^ arrLUT[nTable - 2U][(uBlock >> 16U) & 0xFF] ^ arrLUT[nTable - 3U][uBlock >> 24U];
+		}
+
+		/// @returns: register advanced by the block of the slice size, each byte of the block is resolved by its own table independently of the others
+		static Hash_t UpdateBlock(const Hash_t uState, const std::uint8_t* pSource) noexcept
+		{
+			// the register is never wider than the first two words, the normal one starts from its highest byte
+			const std::uint64_t ullState = REFLECTED ? static_cast<std::uint64_t>(uState) : DETAIL::ByteSwap(static_cast<std::uint64_t>(uState) << (64U - nRegisterBits));
+			Hash_t uResult = LookupWord(SLICE_BY - 1U, DETAIL::LoadBlock(pSource) ^ static_cast<std::uint32_t>(ullState)) ^ LookupWord(SLICE_BY - 5U, DETAIL::LoadBlock(pSource + 4U) ^ static_cast<std::uint32_t>(ullState >> 32U));
+
+			for (std::size_t nWord = 2U; nWord < SLICE_BY / 4U; ++nWord)
+				uResult ^= LookupWord(SLICE_BY - 1U - nWord * 4U, DETAIL::LoadBlock(pSource + nWord * 4U));
+
+			return uResult;
+		}
+
+		/// @returns: register that continues from the given hash
+		static constexpr Hash_t ToState(const Hash_t uHash) noexcept
+		{
+			return static_cast<Hash_t>(((uHash ^ XOR_OUTPUT) & ullMask) << nShift);
+		}
+
+		/// @returns: hash that corresponds to the given register
+		static constexpr Hash_t FromState(const Hash_t uState) noexcept
+		{
+			return static_cast<Hash_t>(((uState >> nShift) ^ XOR_OUTPUT) & ullMask);
+		}
+
+		/// @returns: polynomial of the hash in the normal form, where each bit 'n' is the 'x^n' term
+		static constexpr std::uint64_t ToNormal(const Hash_t uHash) noexcept
+		{
+			return REFLECTED ? DETAIL::Reflect(uHash, WIDTH) : static_cast<std::uint64_t>(uHash);
+		}
+
+		/// @returns: product of the given polynomials modulo generator polynomial, all of them are in the normal form
+		static constexpr std::uint64_t MultiplyModulo(const std::uint64_t ullFirst, const std::uint64_t ullSecond) noexcept
+		{
+			constexpr std::uint64_t ullHighestTerm = 1ULL << (WIDTH - 1U);
+			std::uint64_t ullResult = 0ULL;
+
+			// horner's scheme from the highest term of the first polynomial, each step multiplies the result by 'x'
+			for (std::uint64_t ullTerm = ullHighestTerm; ullTerm != 0U; ullTerm >>= 1U)
+			{
+				ullResult = ((ullResult << 1U) & ullMask) ^ ((ullResult & ullHighestTerm) ? (POLYNOMIAL & ullMask) : 0ULL);
+
+				if (ullFirst & ullTerm)
+					ullResult ^= ullSecond;
+			}
+
+			return ullResult;
+		}
+
+		/// @returns: table of the 'x^(2^n)' modulo generator polynomial for each 'n' that can be reached by 64-bit length in bytes
+		static consteval auto MakePowerLookup()
+		{
+			std::array<std::uint64_t, 64U + 3U> arrTable;
+
+			// 'x^1', that is reduced only by the polynomial of the first degree
+			arrTable[0] = (WIDTH == 1U) ? (POLYNOMIAL & ullMask) : 2ULL;
+			for (std::size_t n = 1U; n < arrTable.size(); ++n)
+				arrTable[n] = MultiplyModulo(arrTable[n - 1U], arrTable[n - 1U]);
+
+			return arrTable;
+		}
+
+		/// @returns: 'x^(8 * nLength)' modulo generator polynomial, i.e. the operator that appends the given count of zero bytes
+		static constexpr std::uint64_t PowerModulo(std::uint64_t nLength) noexcept
+		{
+			// 'x^0'
+			std::uint64_t ullResult = 1ULL;
+
+			// start from 'x^8' as length is given in bytes
+			for (std::size_t n = 3U; nLength != 0U; nLength >>= 1U, ++n)
+			{
+				if (nLength & 1U)
+					ullResult = MultiplyModulo(arrPowerLUT[n], ullResult);
+			}
+
+			return ullResult;
+		}
+
+		// pre-computed powers of 'x' for the combination of the hashes
+		static constexpr auto arrPowerLUT = MakePowerLookup();
+
+	public:
+		// hash of the empty input, which is also the basis to start the generation from
+		static constexpr Hash_t uEmptyHash = static_cast<Hash_t>(((REFLECTED ? DETAIL::Reflect(INITIAL & ullMask, WIDTH) : INITIAL & ullMask) ^ XOR_OUTPUT) & ullMask);
+
+		/// advance the raw register, that is the internal state between the 'ToState' and 'FromState' conversions, for the accelerated paths of the particular instantiations
+		/// @param[in] uState register of the preceding data
+		/// @returns: register of the preceding data followed by the given buffer
+		static constexpr Hash_t Advance(Hash_t uState, const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			if constexpr (SLICE_BY >= 8U)
+			{
+				while (!std::is_constant_evaluated() && nLength >= SLICE_BY)
+				{
+					uState = UpdateBlock(uState, pSource);
+					pSource += SLICE_BY;
+					nLength -= SLICE_BY;
+				}
+			}
+
+			while (nLength-- != 0U)
+				uState = UpdateByte(uState, *pSource++);
+
+			return uState;
+		}
+
+		/* @section: get */
+		/// @param[in] pSource buffer for which the hash will be generated
+		/// @param[in] nLength length of the source buffer in bytes
+		/// @param[in] uBasis hash of the preceding data to continue from
+		/// @returns: calculated hash of the given buffer
+		static constexpr Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const Hash_t uBasis = uEmptyHash) noexcept
+		{
+			return FromState(Advance(ToState(uBasis), pSource, nLength));
+		}
+
+		/// @param[in] szSource null-terminated string for which the hash will be generated
+		/// @param[in] uBasis hash of the preceding data to continue from
+		/// @returns: calculated hash of the given string
+		static constexpr Hash_t Hash(const char* szSource, const Hash_t uBasis = uEmptyHash) noexcept
+		{
+			Hash_t uState = ToState(uBasis);
+
+			while (*szSource != '\0')
+				uState = UpdateByte(uState, static_cast<std::uint8_t>(*szSource++));
+
+			return FromState(uState);
+		}
+
+		/// @param[in] strSource string for which the hash will be generated
+		/// @param[in] uBasis hash of the preceding data to continue from
+		/// @returns: calculated hash of the given string
+		static constexpr Hash_t Hash(const std::string_view strSource, const Hash_t uBasis = uEmptyHash) noexcept
+		{
+			if (!std::is_constant_evaluated())
+				return Hash(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), uBasis);
+
+			Hash_t uState = ToState(uBasis);
+
+			for (const char chSource : strSource)
+				uState = UpdateByte(uState, static_cast<std::uint8_t>(chSource));
+
+			return FromState(uState);
+		}
+
+		/// @param[in] szSource null-terminated string for which the hash will be generated
+		/// @param[in] uBasis hash of the preceding data to continue from
+		/// @returns: calculated at compile-time hash of the given string
+		static consteval Hash_t HashConst(const char* szSource, const Hash_t uBasis = uEmptyHash) noexcept
+		{
+			return Hash(szSource, uBasis);
+		}
+
+		/* @section: stream */
+		/// incremental hash generation of the data split across multiple buffers
+		class CStream
+		{
+		public:
+			/// @param[in] uBasis hash of the preceding data to continue from
+			constexpr explicit CStream(const Hash_t uBasis = uEmptyHash) noexcept :
+				uState(ToState(uBasis)) { }
+
+			/// reset the state to begin a new hash generation
+			/// @param[in] uBasis hash of the preceding data to continue from
+			constexpr void Init(const Hash_t uBasis = uEmptyHash) noexcept
+			{
+				uState = ToState(uBasis);
+			}
+
+			/// @param[in] pSource next buffer of the data
+			/// @param[in] nLength length of the buffer in bytes
+			constexpr void Update(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+			{
+				uState = Advance(uState, pSource, nLength);
+			}
+
+			/// @returns: calculated hash of the all appended data
+			[[nodiscard]] constexpr Hash_t Final() const noexcept
+			{
+				return FromState(uState);
+			}
+
+		private:
+			Hash_t uState;
+		};
+
+		// signature of the function that generates hash of the buffer continuing from the given one, either the own 'Hash' or the accelerated one of the particular instantiation
+		using HashFunction_t = Hash_t(const std::uint8_t* pSource, std::size_t nLength, Hash_t uBasis);
+
+		/// incremental hash generation through the given function, that is called with the hash of the preceding buffers as the basis
+		/// @tparam HASH function of this CRC that generates the hash of each next buffer
+		template <HashFunction_t* HASH>
+		class CHashStream
+		{
+		public:
+			/// @param[in] uBasis hash of the preceding data to continue from
+			constexpr explicit CHashStream(const Hash_t uBasis = uEmptyHash) noexcept :
+				uHash(uBasis) { }
+
+			/// reset the state to begin a new hash generation
+			/// @param[in] uBasis hash of the preceding data to continue from
+			constexpr void Init(const Hash_t uBasis = uEmptyHash) noexcept
+			{
+				uHash = uBasis;
+			}
+
+			/// @param[in] pSource next buffer of the data
+			/// @param[in] nLength length of the buffer in bytes
+			constexpr void Update(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+			{
+				uHash = HASH(pSource, nLength, uHash);
+			}
+
+			/// @param[in] ppSources array of the next buffers of the data, in order
+			/// @param[in] pLengths array of the length of each buffer in bytes
+			/// @param[in] nCount count of the buffers
+			constexpr void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+					Update(ppSources[i], pLengths[i]);
+			}
+
+			/// @returns: calculated hash of the all appended data
+			[[nodiscard]] constexpr Hash_t Final() const noexcept
+			{
+				return uHash;
+			}
+
+		private:
+			Hash_t uHash;
+		};
+
+		/* @section: combine */
+		/// @param[in] uFirst hash of the first buffer
+		/// @param[in] uSecond hash of the second buffer, generated with the default basis
+		/// @param[in] nSecondLength length of the second buffer in bytes
+		/// @returns: hash of the first buffer followed by the second one
+		static constexpr Hash_t Combine(const Hash_t uFirst, const Hash_t uSecond, const std::uint64_t nSecondLength) noexcept
+		{
+			// the second hash already holds the initial register advanced over its length, so only the difference of the first register from the initial one is shifted, the output xors cancel each other
+			const std::uint64_t ullShifted = MultiplyModulo(PowerModulo(nSecondLength), ToNormal(uFirst ^ uEmptyHash));
+
+			// the reflection is its own inverse, so it turns the product back to the form of the hash
+			return static_cast<Hash_t>(ToNormal(static_cast<Hash_t>(ullShifted)) ^ uSecond);
+		}
+
+	#ifdef Q_HASH_CRC_PARALLEL
+		/// split buffer into the equal chunks and generate hash of each one on the separate thread
+		/// @tparam HASH function of this CRC that generates the hash of each chunk
+		/// @param[in] pSource buffer for which the hash will be generated
+		/// @param[in] nLength length of the source buffer in bytes
+		/// @param[in] nThreads maximal count of the threads to use, including the calling one, or zero to use the count of the hardware threads
+		/// @param[in] uBasis hash of the preceding data to continue from
+		/// @returns: hash calculated at run-time of the given buffer, equal to the 'HASH' one
+		template <HashFunction_t* HASH = &Hash>
+		static Hash_t HashParallel(const std::uint8_t* pSource, const std::size_t nLength, std::size_t nThreads = 0U, const Hash_t uBasis = uEmptyHash)
+		{
+			// don't let the threads creation overhead to outweigh the work
+			constexpr std::size_t nMinChunkLength = 1U << 20U;
+
+			if (nThreads == 0U)
+				nThreads = std::thread::hardware_concurrency();
+			if (const std::size_t nMaxThreads = nLength / nMinChunkLength; nThreads > nMaxThreads)
+				nThreads = nMaxThreads;
+
+			if (nThreads <= 1U)
+				return HASH(pSource, nLength, uBasis);
+
+			const std::size_t nChunkLength = nLength / nThreads;
+			std::vector<Hash_t> vecChunkHashes(nThreads);
+			std::vector<std::thread> vecThreads;
+			vecThreads.reserve(nThreads - 1U);
+
+			// the calling thread takes the first chunk, the last one also takes the remainder
+			for (std::size_t nChunk = 1U; nChunk < nThreads; ++nChunk)
+			{
+				const std::size_t nChunkOffset = nChunk * nChunkLength;
+				const std::size_t nCurrentLength = (nChunk == nThreads - 1U) ? nLength - nChunkOffset : nChunkLength;
+				vecThreads.emplace_back([pChunk = pSource + nChunkOffset, nCurrentLength, pResult = &vecChunkHashes[nChunk]]()
+				{
+					*pResult = HASH(pChunk, nCurrentLength, uEmptyHash);
+				});
+			}
+
+			Hash_t uHash = HASH(pSource, nChunkLength, uBasis);
+
+			for (std::size_t nChunk = 1U; nChunk < nThreads; ++nChunk)
+			{
+				vecThreads[nChunk - 1U].join();
+
+				const std::size_t nCurrentLength = (nChunk == nThreads - 1U) ? nLength - nChunk * nChunkLength : nChunkLength;
+				uHash = Combine(uHash, vecChunkHashes[nChunk], nCurrentLength);
+			}
+
+			return uHash;
+		}
+	#endif
+	};
+
+	/* @section: presets */
+	// parameters of the widely used variants, named as in the catalogue of parametrised CRC algorithms
+	using CRC8_SMBUS = CEngine<8U, 0x07, false, 0x00, 0x00>;
+	using CRC16_ARC = CEngine<16U, 0x8005, true, 0x0000, 0x0000>;
+	using CRC16_IBM_3740 = CEngine<16U, 0x1021, false, 0xFFFF, 0x0000>;
+	using CRC16_KERMIT = CEngine<16U, 0x1021, true, 0x0000, 0x0000>;
+	using CRC16_XMODEM = CEngine<16U, 0x1021, false, 0x0000, 0x0000>;
+	using CRC32_ISO_HDLC = CEngine<32U, 0x04C11DB7, true, 0xFFFFFFFF, 0xFFFFFFFF>;
+	using CRC32_BZIP2 = CEngine<32U, 0x04C11DB7, false, 0xFFFFFFFF, 0xFFFFFFFF>;
+	using CRC64_ECMA_182 = CEngine<64U, 0x42F0E1EBA9EA3693, false, 0x0000000000000000, 0x0000000000000000>;
+	using CRC64_NVME = CEngine<64U, 0xAD93D23594C93659, true, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF>;
+	using CRC64_XZ = CEngine<64U, 0x42F0E1EBA9EA3693, true, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF>;
+	// also known as 'CRC-16/CCITT-FALSE'
+	using CRC16_CCITT_FALSE = CRC16_IBM_3740;
+
+#ifdef Q_HASH_CPU_X86
+	/* @section: [internal] carry-less multiplication */
+	// shared by the instantiations that fold the large buffers with the PCLMULQDQ, only the final reduction to the CRC width is their own
+	namespace DETAIL
+	{
+		Q_HASH_TARGET("pclmul") inline __m128i FoldPCLMUL(const __m128i xmmValue, const __m128i xmmConstants, const __m128i xmmNext) noexcept
+		{
+			return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(xmmValue, xmmConstants, 0x00), _mm_clmulepi64_si128(xmmValue, xmmConstants, 0x11)), xmmNext);
+		}
+
+		/// fold the buffer by 64-byte strides with the carry-less multiplication, down to the single 128-bit value that is left to reduce
+		/// @param[in] pSource 16-byte aligned buffer to process
+		/// @param[in] nLength length of the buffer in bytes, must be at least 64 and a multiple of 16
+		/// @param[in] ullState reflected register of the preceding data
+		/// @param[in] xmmFoldByFour constants that fold each of the four lanes over the next 64 bytes
+		/// @param[in] xmmFoldByOne constants that fold the single lane over the next 16 bytes
+		/// @returns: folded value, congruent to the register of the preceding data followed by the given buffer
+		Q_HASH_TARGET("pclmul") inline __m128i FoldBlocksPCLMUL(const std::uint8_t* pSource, std::size_t nLength, const std::uint64_t ullState, const __m128i xmmFoldByFour, const __m128i xmmFoldByOne) noexcept
+		{
+			const __m128i* pBlocks = reinterpret_cast<const __m128i*>(pSource);
+
+			__m128i xmmFirst = _mm_xor_si128(_mm_load_si128(pBlocks), _mm_set_epi64x(0LL, static_cast<long long>(ullState)));
+			__m128i xmmSecond = _mm_load_si128(pBlocks + 1);
+			__m128i xmmThird = _mm_load_si128(pBlocks + 2);
+			__m128i xmmFourth = _mm_load_si128(pBlocks + 3);
+			pBlocks += 4;
+			nLength -= 64U;
+
+			// fold four independent lanes by 64-byte strides
+			while (nLength >= 64U)
+			{
+				xmmFirst = FoldPCLMUL(xmmFirst, xmmFoldByFour, _mm_load_si128(pBlocks));
+				xmmSecond = FoldPCLMUL(xmmSecond, xmmFoldByFour, _mm_load_si128(pBlocks + 1));
+				xmmThird = FoldPCLMUL(xmmThird, xmmFoldByFour, _mm_load_si128(pBlocks + 2));
+				xmmFourth = FoldPCLMUL(xmmFourth, xmmFoldByFour, _mm_load_si128(pBlocks + 3));
+				pBlocks += 4;
+				nLength -= 64U;
+			}
+
+			// fold lanes into the single one
+			xmmFirst = FoldPCLMUL(xmmFirst, xmmFoldByOne, xmmSecond);
+			xmmFirst = FoldPCLMUL(xmmFirst, xmmFoldByOne, xmmThird);
+			xmmFirst = FoldPCLMUL(xmmFirst, xmmFoldByOne, xmmFourth);
+
+			// fold the remaining 16-byte blocks
+			while (nLength >= 16U)
+			{
+				xmmFirst = FoldPCLMUL(xmmFirst, xmmFoldByOne, _mm_load_si128(pBlocks++));
+				nLength -= 16U;
+			}
+
+			return xmmFirst;
+		}
+
+		/// entry point that folds the 16-byte aligned bulk of the buffer with the given kernel on CPUs with the carry-less multiplication, and leaves the whole buffer to the table otherwise
+		/// @tparam TEngine table-driven part of the reflected CRC, that processes the misaligned head
+		/// @tparam FOLD kernel that is called as 'FOLD(pSource, nLength, uState)' with the aligned bulk, see 'FoldBlocksPCLMUL'
+		template <typename TEngine, typename TEngine::Hash_t (*FOLD)(const std::uint8_t*, std::size_t, typename TEngine::Hash_t) noexcept>
+		class CFoldDispatch
+		{
+			using Hash_t = typename TEngine::Hash_t;
+
+		public:
+			using Function_t = Hash_t(const std::uint8_t*&, std::size_t&, Hash_t) noexcept;
+
+		private:
+			/// @param[in,out] pSource buffer to process, that is advanced past the folded bytes
+			/// @param[in,out] nLength length of the buffer in bytes, must be at least 128, that is decreased by the count of the folded bytes
+			/// @param[in] uState register of the preceding data
+			/// @returns: register of the preceding data followed by the folded bytes
+			static Hash_t AdvancePCLMUL(const std::uint8_t*& pSource, std::size_t& nLength, Hash_t uState) noexcept
+			{
+				// process the head bytes until the buffer is aligned
+				const std::size_t nHeadLength = (0U - reinterpret_cast<std::uintptr_t>(pSource)) & 15U;
+				uState = TEngine::Advance(uState, pSource, nHeadLength);
+				pSource += nHeadLength;
+				nLength -= nHeadLength;
+
+				const std::size_t nFoldLength = nLength & ~static_cast<std::size_t>(15U);
+				uState = FOLD(pSource, nFoldLength, uState);
+				pSource += nFoldLength;
+				nLength -= nFoldLength;
+				return uState;
+			}
+
+			static Hash_t AdvanceNone(const std::uint8_t*&, std::size_t&, const Hash_t uState) noexcept
+			{
+				return uState;
+			}
+
+			static Function_t* Resolve() noexcept
+			{
+				if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_PCLMUL))
+					return &AdvancePCLMUL;
+
+				return &AdvanceNone;
+			}
+
+		public:
+			using Dispatch_t = Q_HASH::CPU::CDispatch<Function_t, &Resolve>;
+		};
+	}
+#endif
+}
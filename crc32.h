@@ -4,15 +4,36 @@
 // used: [stl] uint8_t, uint32_t
 #include <cstdint>
 
-#ifndef Q_HASH_CRC32_NO_LUT
-// used: [stl] array
-#include <array>
-#endif
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+// used: cengine, reflect, foldblockspclmul, cfolddispatch
+#include "crc.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
 
 #ifndef Q_HASH_CRC32_POLY
 #define Q_HASH_CRC32_POLY 0xEDB88320
 #endif
 
+#if !defined(Q_HASH_CRC32_NO_LUT) && !defined(Q_HASH_CRC32_NO_PCLMUL)
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch
+#include "cpu.h"
+
+#ifdef Q_HASH_CPU_X86
+// used: [intrin] _mm_clmulepi64_si128, sse2
+#include <wmmintrin.h>
+
+#define Q_HASH_CRC32_PCLMUL
+#endif
+#endif
+
+#if defined(Q_HASH_CRC32_SLICE_BY) && !defined(Q_HASH_CRC32_NO_LUT)
+static_assert(Q_HASH_CRC32_SLICE_BY == 8 || Q_HASH_CRC32_SLICE_BY == 16, "Q_HASH_CRC32_SLICE_BY must be either 8 or 16");
+#endif
+
 using CRC32_t = std::uint32_t;
 
 /*
@@ -20,30 +41,95 @@ using CRC32_t = std::uint32_t;
  */
 namespace CRC32
 {
-#ifndef Q_HASH_CRC32_NO_LUT
 	namespace DETAIL
 	{
-		consteval auto MakePolynomialLookup(const CRC32_t uPolynomial)
+	#if defined(Q_HASH_CRC32_NO_LUT)
+		inline constexpr std::size_t nSliceBy = 0U;
+	#elif defined(Q_HASH_CRC32_SLICE_BY)
+		inline constexpr std::size_t nSliceBy = Q_HASH_CRC32_SLICE_BY;
+	#else
+		inline constexpr std::size_t nSliceBy = 1U;
+	#endif
+
+		// table-driven part of the algorithm, the selected polynomial is given in the reflected form so it's turned back to the normal one
+		using Engine_t = Q_HASH::CRC::CEngine<32U, Q_HASH::CRC::DETAIL::Reflect(Q_HASH_CRC32_POLY, 32U), true, 0xFFFFFFFF, 0xFFFFFFFF, nSliceBy>;
+	}
+
+#ifdef Q_HASH_CRC32_PCLMUL
+	namespace DETAIL
+	{
+		/// @returns: bit-reflected remainder of the 'x^nExponent' modulo polynomial, in the 33-bit form expected by the carry-less multiplication
+		consteval std::uint64_t MakeFoldConstant(const CRC32_t uPolynomial, const unsigned int nExponent)
 		{
-			std::array<CRC32_t, 256U> arrTable;
+			// '1' in the reflected representation, each next shift multiplies the remainder by 'x'
+			CRC32_t uRemainder = 0x80000000;
 
-			for (std::uint32_t uByte = 0U; uByte < 256U; ++uByte)
-			{
-				CRC32_t uResult = uByte;
+			for (unsigned int i = 0U; i < nExponent; ++i)
+				uRemainder = (uRemainder >> 1U) ^ (uPolynomial & -static_cast<std::int32_t>(uRemainder & 1U));
 
-				for (int i = 0U; i < 8; ++i)
-					uResult = (uResult >> 1U) ^ (uPolynomial & -static_cast<std::int32_t>(uResult & 1U));
+			return static_cast<std::uint64_t>(uRemainder) << 1U;
+		}
 
-				arrTable[uByte] = uResult;
+		/// @returns: bit-reflected quotient of the 'x^64' divided by polynomial, used for the barrett reduction
+		consteval std::uint64_t MakeBarrettConstant(const CRC32_t uPolynomial)
+		{
+			const std::uint64_t ullPolynomial = Q_HASH::CRC::DETAIL::Reflect(uPolynomial, 32U) | (1ULL << 32U);
+			std::uint64_t ullRemainder = 1ULL << 32U, ullQuotient = 0ULL;
+
+			for (int i = 32; i >= 0; --i)
+			{
+				if (ullRemainder & (1ULL << 32U))
+				{
+					ullQuotient |= 1ULL << i;
+					ullRemainder ^= ullPolynomial;
+				}
+
+				ullRemainder <<= 1U;
 			}
 
-			return arrTable;
+			return Q_HASH::CRC::DETAIL::Reflect(ullQuotient, 33U);
 		}
 
 		/* @section: [internal] constants */
-		// pre-computed LUT for a selected polynomial
-		// @todo: avoid using 'std::array' as it may? involve SEH at run-time
-		constexpr auto arrPolynomialLUT = MakePolynomialLookup(Q_HASH_CRC32_POLY);
+		// fold constants for a selected polynomial
+		inline constexpr std::uint64_t ullFoldByFourLow = MakeFoldConstant(Q_HASH_CRC32_POLY, 4U * 128U + 32U);
+		inline constexpr std::uint64_t ullFoldByFourHigh = MakeFoldConstant(Q_HASH_CRC32_POLY, 4U * 128U - 32U);
+		inline constexpr std::uint64_t ullFoldByOneLow = MakeFoldConstant(Q_HASH_CRC32_POLY, 128U + 32U);
+		inline constexpr std::uint64_t ullFoldByOneHigh = MakeFoldConstant(Q_HASH_CRC32_POLY, 128U - 32U);
+		inline constexpr std::uint64_t ullFoldToHalf = MakeFoldConstant(Q_HASH_CRC32_POLY, 64U);
+		// barrett reduction constants for a selected polynomial
+		inline constexpr std::uint64_t ullReducePolynomial = (static_cast<std::uint64_t>(Q_HASH_CRC32_POLY) << 1U) | 1ULL;
+		inline constexpr std::uint64_t ullReduceQuotient = MakeBarrettConstant(Q_HASH_CRC32_POLY);
+
+		/// fold the buffer with the carry-less multiplication and reduce it to 32 bits
+		/// @param[in] pSource 16-byte aligned buffer to process
+		/// @param[in] nLength length of the buffer in bytes, must be at least 64 and a multiple of 16
+		/// @param[in] uState inverted CRC of the preceding data
+		/// @returns: inverted CRC of the preceding data followed by the given buffer
+		Q_HASH_TARGET("pclmul") inline CRC32_t HashPCLMUL(const std::uint8_t* pSource, std::size_t nLength, const CRC32_t uState) noexcept
+		{
+			const __m128i xmmFoldByOne = _mm_set_epi64x(static_cast<long long>(ullFoldByOneHigh), static_cast<long long>(ullFoldByOneLow));
+			__m128i xmmFirst = Q_HASH::CRC::DETAIL::FoldBlocksPCLMUL(pSource, nLength, uState, _mm_set_epi64x(static_cast<long long>(ullFoldByFourHigh), static_cast<long long>(ullFoldByFourLow)), xmmFoldByOne);
+
+			// fold 128 bits to 64 bits
+			const __m128i xmmLowMask = _mm_setr_epi32(-1, 0, -1, 0);
+			__m128i xmmTemporary = _mm_clmulepi64_si128(xmmFirst, xmmFoldByOne, 0x10);
+			xmmFirst = _mm_xor_si128(_mm_srli_si128(xmmFirst, 8), xmmTemporary);
+			xmmTemporary = _mm_srli_si128(xmmFirst, 4);
+			xmmFirst = _mm_clmulepi64_si128(_mm_and_si128(xmmFirst, xmmLowMask), _mm_set_epi64x(0LL, static_cast<long long>(ullFoldToHalf)), 0x00);
+			xmmFirst = _mm_xor_si128(xmmFirst, xmmTemporary);
+
+			// barrett reduction to 32 bits
+			const __m128i xmmReduce = _mm_set_epi64x(static_cast<long long>(ullReduceQuotient), static_cast<long long>(ullReducePolynomial));
+			xmmTemporary = _mm_clmulepi64_si128(_mm_and_si128(xmmFirst, xmmLowMask), xmmReduce, 0x10);
+			xmmTemporary = _mm_clmulepi64_si128(_mm_and_si128(xmmTemporary, xmmLowMask), xmmReduce, 0x00);
+			xmmFirst = _mm_xor_si128(xmmFirst, xmmTemporary);
+
+			return static_cast<CRC32_t>(_mm_cvtsi128_si32(_mm_srli_si128(xmmFirst, 4)));
+		}
+
+		// fold the 16-byte aligned bulk of the buffer, leaving the remaining bytes to the table
+		using HashBulkDispatch_t = Q_HASH::CRC::DETAIL::CFoldDispatch<Engine_t, &HashPCLMUL>::Dispatch_t;
 	}
 #endif
 
@@ -51,44 +137,35 @@ namespace CRC32
 	/// @param[in] pSource buffer for which the hash will be generated
 	/// @param[in] nLength length of the source buffer in bytes
 	/// @param[in] uBasis initial key of the hash generation
-	/// @returns: hash calculated at run-time of the given buffer
-	inline CRC32_t Hash(const std::uint8_t* pSource, std::size_t nLength, CRC32_t uBasis = 0U)
+	/// @returns: calculated hash of the given buffer
+	constexpr CRC32_t Hash(const std::uint8_t* pSource, std::size_t nLength, CRC32_t uBasis = 0U)
 	{
-		uBasis = ~uBasis;
+	#ifdef Q_HASH_CRC32_PCLMUL
+		// the folding setup pays off only for the large enough buffers
+		if (!std::is_constant_evaluated() && nLength >= 128U)
+			uBasis = ~DETAIL::HashBulkDispatch_t::Call(pSource, nLength, ~uBasis);
+	#endif
 
-		while (nLength-- != 0U)
-		{
-		#ifndef Q_HASH_CRC32_NO_LUT
-			uBasis = (uBasis >> 8U) ^ DETAIL::arrPolynomialLUT[(uBasis ^ *pSource++) & 0xFF];
-		#else
-			uBasis ^= *pSource++;
-			for (unsigned int nTimes = 0U; nTimes < 8U; ++nTimes)
-				uBasis = (uBasis >> 1U) ^ (Q_HASH_CRC32_POLY & -static_cast<std::int32_t>(uBasis & 1U));
-		#endif
-		}
-
-		return ~uBasis;
+		return DETAIL::Engine_t::Hash(pSource, nLength, uBasis);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] uBasis initial key of the hash generation
 	/// @returns: calculated hash of the given string
-	constexpr CRC32_t Hash(const char* szSource, CRC32_t uBasis = 0U) noexcept
+	constexpr CRC32_t Hash(const char* szSource, const CRC32_t uBasis = 0U) noexcept
 	{
-		uBasis = ~uBasis;
+		return DETAIL::Engine_t::Hash(szSource, uBasis);
+	}
 
-		while (*szSource != '\0')
-		{
-		#ifndef Q_HASH_CRC32_NO_LUT
-			uBasis = (uBasis >> 8U) ^ DETAIL::arrPolynomialLUT[(uBasis ^ static_cast<std::uint8_t>(*szSource++)) & 0xFF];
-		#else
-			uBasis ^= static_cast<std::uint8_t>(*szSource++);
-			for (unsigned int nTimes = 0U; nTimes < 8U; ++nTimes)
-				uBasis = (uBasis >> 1U) ^ (Q_HASH_CRC32_POLY & -static_cast<std::int32_t>(uBasis & 1U));
-		#endif
-		}
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr CRC32_t Hash(const std::string_view strSource, const CRC32_t uBasis = 0U) noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return Hash(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), uBasis);
 
-		return ~uBasis;
+		return DETAIL::Engine_t::Hash(strSource, uBasis);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
@@ -98,4 +175,106 @@ namespace CRC32
 	{
 		return Hash(szSource, uBasis);
 	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	using CStream = DETAIL::Engine_t::CHashStream<&Hash>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline CRC32_t Hash(const TChar* szSource, const CRC32_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline CRC32_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC32_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval CRC32_t HashConst(const TChar* szSource, const CRC32_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval CRC32_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC32_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uBasis); });
+	}
+
+	/* @section: combine */
+	/// @param[in] uFirst hash of the first buffer
+	/// @param[in] uSecond hash of the second buffer, generated with zero basis
+	/// @param[in] nSecondLength length of the second buffer in bytes
+	/// @returns: hash of the first buffer followed by the second one
+	constexpr CRC32_t Combine(const CRC32_t uFirst, const CRC32_t uSecond, const std::uint64_t nSecondLength) noexcept
+	{
+		return DETAIL::Engine_t::Combine(uFirst, uSecond, nSecondLength);
+	}
+
+#ifndef Q_HASH_CRC32_NO_PARALLEL
+	/// split buffer into the equal chunks and generate hash of each one on the separate thread
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] nThreads maximal count of the threads to use, including the calling one, or zero to use the count of the hardware threads
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: hash calculated at run-time of the given buffer, equal to the 'Hash' one
+	inline CRC32_t HashParallel(const std::uint8_t* pSource, const std::size_t nLength, std::size_t nThreads = 0U, const CRC32_t uBasis = 0U)
+	{
+		return DETAIL::Engine_t::HashParallel<&Hash>(pSource, nLength, nThreads, uBasis);
+	}
+#endif
 }
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct CRC32
+	{
+		using Hash_t = CRC32_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC32::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC32::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_crc32'
+	consteval CRC32_t operator""_crc32(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return CRC32::Hash(std::string_view(szSource, nLength));
+	}
+}
+#endif
@@ -0,0 +1,355 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t
+#include <cstdint>
+// used: [stl] array
+#include <array>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+#ifndef Q_HASH_CRC32C_NO_SSE42
+// used: Q_HASH_CPU_X86, Q_HASH_CPU_X64, Q_HASH_TARGET, hasfeatures, cdispatch
+#include "cpu.h"
+
+#ifdef Q_HASH_CPU_X86
+// used: [stl] memcpy
+#include <cstring>
+// used: [intrin] _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+#include <nmmintrin.h>
+
+#define Q_HASH_CRC32C_SSE42
+#endif
+#endif
+
+#define Q_HASH_CRC32C
+
+using CRC32C_t = std::uint32_t;
+
+/*
+ * 32-BIT CYCLIC REDUNDANCY CHECK HASH ALGORITHM WITH CASTAGNOLI POLYNOMIAL
+ * @note: polynomial is fixed as the hardware accelerated path is bound to it
+ */
+namespace CRC32C
+{
+	namespace DETAIL
+	{
+		// reversed castagnoli polynomial
+		inline constexpr CRC32C_t uPolynomial = 0x82F63B78;
+
+		consteval auto MakePolynomialLookup()
+		{
+			std::array<CRC32C_t, 256U> arrTable;
+
+			for (std::uint32_t uByte = 0U; uByte < 256U; ++uByte)
+			{
+				CRC32C_t uResult = uByte;
+
+				for (int i = 0U; i < 8; ++i)
+					uResult = (uResult >> 1U) ^ (uPolynomial & -static_cast<std::int32_t>(uResult & 1U));
+
+				arrTable[uByte] = uResult;
+			}
+
+			return arrTable;
+		}
+
+		/* @section: [internal] constants */
+		// pre-computed LUT for the castagnoli polynomial
+		inline constexpr auto arrPolynomialLUT = MakePolynomialLookup();
+
+		template <typename T>
+		constexpr CRC32C_t HashTable(const T* pSource, std::size_t nLength, CRC32C_t uState) noexcept
+		{
+			while (nLength-- != 0U)
+				uState = (uState >> 8U) ^ arrPolynomialLUT[(uState ^ static_cast<std::uint8_t>(*pSource++)) & 0xFF];
+
+			return uState;
+		}
+
+	#ifdef Q_HASH_CRC32C_SSE42
+		/// @returns: lookup tables of the operator that appends given count of zero bytes to the CRC register, indexed by each byte of the register
+		consteval auto MakeShiftLookup(const std::size_t nZeroBytes)
+		{
+			// get 'x^(8 * nZeroBytes)' modulo polynomial, where '1' in the reflected representation is the highest bit
+			CRC32C_t uPower = 0x80000000;
+			for (std::size_t i = 0U; i < nZeroBytes * 8U; ++i)
+				uPower = (uPower >> 1U) ^ (uPolynomial & -static_cast<std::int32_t>(uPower & 1U));
+
+			std::array<std::array<CRC32C_t, 256U>, 4U> arrTables;
+			for (std::uint32_t nByte = 0U; nByte < 4U; ++nByte)
+			{
+				for (std::uint32_t uByte = 0U; uByte < 256U; ++uByte)
+				{
+					// multiply register by the power modulo polynomial
+					CRC32C_t uMultiplier = uByte << (nByte * 8U), uResult = 0U, uFactor = uPower;
+					for (std::uint32_t uMask = 0x80000000; uMask != 0U; uMask >>= 1U)
+					{
+						if (uMultiplier & uMask)
+							uResult ^= uFactor;
+
+						uFactor = (uFactor >> 1U) ^ (uPolynomial & -static_cast<std::int32_t>(uFactor & 1U));
+					}
+
+					arrTables[nByte][uByte] = uResult;
+				}
+			}
+
+			return arrTables;
+		}
+
+		// length of the each interleaved stream for the large and medium buffers
+		inline constexpr std::size_t nLongStream = 8192U;
+		inline constexpr std::size_t nShortStream = 256U;
+		// pre-computed operators to skip the length of the stream
+		inline constexpr auto arrShiftLongLUT = MakeShiftLookup(nLongStream);
+		inline constexpr auto arrShiftShortLUT = MakeShiftLookup(nShortStream);
+
+		inline CRC32C_t Shift(const std::array<std::array<CRC32C_t, 256U>, 4U>& arrShiftLUT, const CRC32C_t uState) noexcept
+		{
+			return arrShiftLUT[0][uState & 0xFF] ^ arrShiftLUT[1][(uState >> 8U) & 0xFF] ^ arrShiftLUT[2][(uState >> 16U) & 0xFF] ^ arrShiftLUT[3][uState >> 24U];
+		}
+
+	#ifdef Q_HASH_CPU_X64
+		using Word_t = std::uint64_t;
+	#else
+		using Word_t = std::uint32_t;
+	#endif
+
+		Q_HASH_TARGET("sse4.2") inline Word_t Step(const Word_t uState, const std::uint8_t* pSource) noexcept
+		{
+			Word_t uWord;
+			std::memcpy(&uWord, pSource, sizeof(Word_t));
+
+		#ifdef Q_HASH_CPU_X64
+			return _mm_crc32_u64(uState, uWord);
+		#else
+			return _mm_crc32_u32(uState, uWord);
+		#endif
+		}
+
+		/// process blocks of three equal streams at once, so the independent instructions hide the latency of each other
+		template <std::size_t N>
+		Q_HASH_TARGET("sse4.2") inline CRC32C_t HashInterleaved(const std::uint8_t*& pSource, std::size_t& nLength, CRC32C_t uState, const std::array<std::array<CRC32C_t, 256U>, 4U>& arrShiftLUT) noexcept
+		{
+			while (nLength >= N * 3U)
+			{
+				Word_t uFirst = uState, uSecond = 0U, uThird = 0U;
+
+				for (const std::uint8_t* pEnd = pSource + N; pSource < pEnd; pSource += sizeof(Word_t))
+				{
+					uFirst = Step(uFirst, pSource);
+					uSecond = Step(uSecond, pSource + N);
+					uThird = Step(uThird, pSource + N * 2U);
+				}
+
+				// combine streams as they would be processed sequentially
+				uState = Shift(arrShiftLUT, static_cast<CRC32C_t>(uFirst)) ^ static_cast<CRC32C_t>(uSecond);
+				uState = Shift(arrShiftLUT, uState) ^ static_cast<CRC32C_t>(uThird);
+
+				pSource += N * 2U;
+				nLength -= N * 3U;
+			}
+
+			return uState;
+		}
+
+		Q_HASH_TARGET("sse4.2") inline CRC32C_t HashSSE42(const std::uint8_t* pSource, std::size_t nLength, CRC32C_t uState) noexcept
+		{
+			uState = HashInterleaved<nLongStream>(pSource, nLength, uState, arrShiftLongLUT);
+			uState = HashInterleaved<nShortStream>(pSource, nLength, uState, arrShiftShortLUT);
+
+			Word_t uWordState = uState;
+			for (; nLength >= sizeof(Word_t); nLength -= sizeof(Word_t), pSource += sizeof(Word_t))
+				uWordState = Step(uWordState, pSource);
+			uState = static_cast<CRC32C_t>(uWordState);
+
+			while (nLength-- != 0U)
+				uState = _mm_crc32_u8(uState, *pSource++);
+
+			return uState;
+		}
+
+		using HashKernel_t = CRC32C_t(const std::uint8_t*, std::size_t, CRC32C_t) noexcept;
+
+		inline HashKernel_t* ResolveHash() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_SSE42))
+				return &HashSSE42;
+
+			return &HashTable<std::uint8_t>;
+		}
+
+		using HashDispatch_t = Q_HASH::CPU::CDispatch<HashKernel_t, &ResolveHash>;
+	#endif
+	}
+
+	/* @section: get */
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr CRC32C_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const CRC32C_t uBasis = 0U) noexcept
+	{
+	#ifdef Q_HASH_CRC32C_SSE42
+		if (!std::is_constant_evaluated())
+			return ~DETAIL::HashDispatch_t::Call(pSource, nLength, ~uBasis);
+	#endif
+
+		return ~DETAIL::HashTable(pSource, nLength, ~uBasis);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr CRC32C_t Hash(const char* szSource, CRC32C_t uBasis = 0U) noexcept
+	{
+		uBasis = ~uBasis;
+
+		while (*szSource != '\0')
+			uBasis = (uBasis >> 8U) ^ DETAIL::arrPolynomialLUT[(uBasis ^ static_cast<std::uint8_t>(*szSource++)) & 0xFF];
+
+		return ~uBasis;
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr CRC32C_t Hash(const std::string_view strSource, const CRC32C_t uBasis = 0U) noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return Hash(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), uBasis);
+
+		return ~DETAIL::HashTable(strSource.data(), strSource.size(), ~uBasis);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval CRC32C_t HashConst(const char* szSource, const CRC32C_t uBasis = 0U) noexcept
+	{
+		return Hash(szSource, uBasis);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr explicit CStream(const CRC32C_t uBasis = 0U) noexcept :
+			uHash(uBasis) { }
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr void Init(const CRC32C_t uBasis = 0U) noexcept
+		{
+			uHash = uBasis;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			uHash = Hash(pSource, nLength, uHash);
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] constexpr CRC32C_t Final() const noexcept
+		{
+			return uHash;
+		}
+
+	private:
+		CRC32C_t uHash;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline CRC32C_t Hash(const TChar* szSource, const CRC32C_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline CRC32C_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC32C_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval CRC32C_t HashConst(const TChar* szSource, const CRC32C_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval CRC32C_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC32C_t uBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uBasis); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct CRC32C
+	{
+		using Hash_t = CRC32C_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC32C::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC32C::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_crc32c'
+	consteval CRC32C_t operator""_crc32c(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return CRC32C::Hash(std::string_view(szSource, nLength));
+	}
+}
+#endif
@@ -0,0 +1,280 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint64_t
+#include <cstdint>
+
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+// used: cengine, reflect, foldblockspclmul, cfolddispatch
+#include "crc.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+// reversed ECMA-182 polynomial, as used by xz, define it to 0x9A6C9329AC4BC9B5 to get the NVMe one
+#ifndef Q_HASH_CRC64_POLY
+#define Q_HASH_CRC64_POLY 0xC96C5795D7870F42
+#endif
+
+#if !defined(Q_HASH_CRC64_NO_LUT) && !defined(Q_HASH_CRC64_NO_PCLMUL)
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch
+#include "cpu.h"
+
+#ifdef Q_HASH_CPU_X86
+// used: [intrin] _mm_clmulepi64_si128, sse2
+#include <wmmintrin.h>
+
+#define Q_HASH_CRC64_PCLMUL
+#endif
+#endif
+
+#if defined(Q_HASH_CRC64_SLICE_BY) && !defined(Q_HASH_CRC64_NO_LUT)
+static_assert(Q_HASH_CRC64_SLICE_BY == 8 || Q_HASH_CRC64_SLICE_BY == 16, "Q_HASH_CRC64_SLICE_BY must be either 8 or 16");
+#endif
+
+using CRC64_t = std::uint64_t;
+
+/*
+ * 64-BIT CYCLIC REDUNDANCY CHECK HASH ALGORITHM
+ */
+namespace CRC64
+{
+	namespace DETAIL
+	{
+	#if defined(Q_HASH_CRC64_NO_LUT)
+		inline constexpr std::size_t nSliceBy = 0U;
+	#elif defined(Q_HASH_CRC64_SLICE_BY)
+		inline constexpr std::size_t nSliceBy = Q_HASH_CRC64_SLICE_BY;
+	#else
+		inline constexpr std::size_t nSliceBy = 1U;
+	#endif
+
+		// table-driven part of the algorithm, the selected polynomial is given in the reflected form so it's turned back to the normal one
+		using Engine_t = Q_HASH::CRC::CEngine<64U, Q_HASH::CRC::DETAIL::Reflect(Q_HASH_CRC64_POLY, 64U), true, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, nSliceBy>;
+	}
+
+#ifdef Q_HASH_CRC64_PCLMUL
+	namespace DETAIL
+	{
+		/// @returns: bit-reflected remainder of the 'x^nExponent' modulo polynomial
+		/// @note: the carry-less multiplication of two reflected values gives the product that is one bit short of the 128-bit reflected form, so the constants for the 'x^n' multipliers are taken as 'x^(n - 1)' to make up for it
+		consteval std::uint64_t MakeFoldConstant(const CRC64_t ullPolynomial, const unsigned int nExponent)
+		{
+			// '1' in the reflected representation, each next shift multiplies the remainder by 'x'
+			CRC64_t ullRemainder = 0x8000000000000000;
+
+			for (unsigned int i = 0U; i < nExponent; ++i)
+				ullRemainder = (ullRemainder >> 1U) ^ (ullPolynomial & (0ULL - (ullRemainder & 1U)));
+
+			return ullRemainder;
+		}
+
+		/// @returns: bit-reflected quotient of the 'x^128' divided by polynomial, without its 'x^64' term, used for the barrett reduction
+		consteval std::uint64_t MakeBarrettConstant(const CRC64_t ullPolynomial)
+		{
+			CRC64_t ullRemainder = 0x8000000000000000, ullQuotient = 0ULL;
+
+			// each reduction while multiplying '1' up to the 'x^128' contributes the matching term to the quotient
+			for (unsigned int i = 0U; i < 128U; ++i)
+			{
+				const std::uint64_t ullCarry = ullRemainder & 1U;
+				if (i >= 64U)
+					ullQuotient |= ullCarry << (i - 64U);
+
+				ullRemainder = (ullRemainder >> 1U) ^ (ullPolynomial & (0ULL - ullCarry));
+			}
+
+			return ullQuotient;
+		}
+
+		/* @section: [internal] constants */
+		// fold constants for a selected polynomial
+		inline constexpr std::uint64_t ullFoldByFourLow = MakeFoldConstant(Q_HASH_CRC64_POLY, 4U * 128U + 64U - 1U);
+		inline constexpr std::uint64_t ullFoldByFourHigh = MakeFoldConstant(Q_HASH_CRC64_POLY, 4U * 128U - 1U);
+		inline constexpr std::uint64_t ullFoldByOneLow = MakeFoldConstant(Q_HASH_CRC64_POLY, 128U + 64U - 1U);
+		inline constexpr std::uint64_t ullFoldByOneHigh = MakeFoldConstant(Q_HASH_CRC64_POLY, 128U - 1U);
+		// barrett reduction constants for a selected polynomial
+		inline constexpr std::uint64_t ullReducePolynomial = Q_HASH_CRC64_POLY;
+		inline constexpr std::uint64_t ullReduceQuotient = MakeBarrettConstant(Q_HASH_CRC64_POLY);
+
+		/// fold the buffer with the carry-less multiplication and reduce it to 64 bits
+		/// @param[in] pSource 16-byte aligned buffer to process
+		/// @param[in] nLength length of the buffer in bytes, must be at least 64 and a multiple of 16
+		/// @param[in] ullState inverted CRC of the preceding data
+		/// @returns: inverted CRC of the preceding data followed by the given buffer
+		Q_HASH_TARGET("pclmul") inline CRC64_t HashPCLMUL(const std::uint8_t* pSource, std::size_t nLength, const CRC64_t ullState) noexcept
+		{
+			const __m128i xmmFoldByOne = _mm_set_epi64x(static_cast<long long>(ullFoldByOneHigh), static_cast<long long>(ullFoldByOneLow));
+			__m128i xmmFirst = Q_HASH::CRC::DETAIL::FoldBlocksPCLMUL(pSource, nLength, ullState, _mm_set_epi64x(static_cast<long long>(ullFoldByFourHigh), static_cast<long long>(ullFoldByFourLow)), xmmFoldByOne);
+
+			// fold the low half onto the high one, that leaves the 128-bit remainder whose high half of terms is still to be reduced
+			__m128i xmmTemporary = _mm_clmulepi64_si128(xmmFirst, xmmFoldByOne, 0x10);
+			const __m128i xmmHigh = _mm_xor_si128(xmmTemporary, _mm_srli_si128(xmmFirst, 8));
+			const __m128i xmmLow = _mm_srli_si128(xmmTemporary, 8);
+
+			// barrett reduction to 64 bits, the shifts align the one bit short products
+			const __m128i xmmReduce = _mm_set_epi64x(static_cast<long long>(ullReduceQuotient), static_cast<long long>(ullReducePolynomial));
+			xmmTemporary = _mm_clmulepi64_si128(xmmHigh, xmmReduce, 0x10);
+			xmmTemporary = _mm_xor_si128(_mm_slli_epi64(xmmTemporary, 1), xmmHigh);
+			xmmTemporary = _mm_clmulepi64_si128(xmmTemporary, xmmReduce, 0x00);
+			xmmTemporary = _mm_or_si128(_mm_srli_epi64(xmmTemporary, 63), _mm_slli_epi64(_mm_srli_si128(xmmTemporary, 8), 1));
+			xmmFirst = _mm_xor_si128(xmmTemporary, xmmLow);
+
+			CRC64_t ullResult;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&ullResult), xmmFirst);
+			return ullResult;
+		}
+
+		// fold the 16-byte aligned bulk of the buffer, leaving the remaining bytes to the table
+		using HashBulkDispatch_t = Q_HASH::CRC::DETAIL::CFoldDispatch<Engine_t, &HashPCLMUL>::Dispatch_t;
+	}
+#endif
+
+	/* @section: get */
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr CRC64_t Hash(const std::uint8_t* pSource, std::size_t nLength, CRC64_t ullBasis = 0U)
+	{
+	#ifdef Q_HASH_CRC64_PCLMUL
+		// the folding setup pays off only for the large enough buffers
+		if (!std::is_constant_evaluated() && nLength >= 128U)
+			ullBasis = ~DETAIL::HashBulkDispatch_t::Call(pSource, nLength, ~ullBasis);
+	#endif
+
+		return DETAIL::Engine_t::Hash(pSource, nLength, ullBasis);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr CRC64_t Hash(const char* szSource, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return DETAIL::Engine_t::Hash(szSource, ullBasis);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr CRC64_t Hash(const std::string_view strSource, const CRC64_t ullBasis = 0U) noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return Hash(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), ullBasis);
+
+		return DETAIL::Engine_t::Hash(strSource, ullBasis);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval CRC64_t HashConst(const char* szSource, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return Hash(szSource, ullBasis);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	using CStream = DETAIL::Engine_t::CHashStream<&Hash>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline CRC64_t Hash(const TChar* szSource, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(ullBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline CRC64_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(ullBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval CRC64_t HashConst(const TChar* szSource, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval CRC64_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const CRC64_t ullBasis = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullBasis); });
+	}
+
+	/* @section: combine */
+	/// @param[in] ullFirst hash of the first buffer
+	/// @param[in] ullSecond hash of the second buffer, generated with zero basis
+	/// @param[in] nSecondLength length of the second buffer in bytes
+	/// @returns: hash of the first buffer followed by the second one
+	constexpr CRC64_t Combine(const CRC64_t ullFirst, const CRC64_t ullSecond, const std::uint64_t nSecondLength) noexcept
+	{
+		return DETAIL::Engine_t::Combine(ullFirst, ullSecond, nSecondLength);
+	}
+
+#ifndef Q_HASH_CRC64_NO_PARALLEL
+	/// split buffer into the equal chunks and generate hash of each one on the separate thread
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] nThreads maximal count of the threads to use, including the calling one, or zero to use the count of the hardware threads
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: hash calculated at run-time of the given buffer, equal to the 'Hash' one
+	inline CRC64_t HashParallel(const std::uint8_t* pSource, const std::size_t nLength, std::size_t nThreads = 0U, const CRC64_t ullBasis = 0U)
+	{
+		return DETAIL::Engine_t::HashParallel<&Hash>(pSource, nLength, nThreads, ullBasis);
+	}
+#endif
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct CRC64
+	{
+		using Hash_t = CRC64_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC64::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::CRC64::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_crc64'
+	consteval CRC64_t operator""_crc64(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return CRC64::Hash(std::string_view(szSource, nLength));
+	}
+}
+#endif
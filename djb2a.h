@@ -1,6 +1,13 @@
 #pragma once
+// used: [stl] size_t
+#include <cstddef>
 // used: [stl] uint32_t
 #include <cstdint>
+// used: [stl] string_view
+#include <string_view>
+
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst, hashlength32
+#include "fold.h"
 
 #define Q_HASH_DJB2A
 
@@ -19,7 +26,7 @@ namespace DJB2A
 	/// @param[in] nLength length of the source buffer in bytes
 	/// @param[in] uBasis initial key of the hash generation
 	/// @returns: calculated hash of the given buffer
-	inline DJB2A_t Hash(const std::uint8_t* pSource, std::uint32_t nLength, DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	constexpr DJB2A_t Hash(const std::uint8_t* pSource, std::uint32_t nLength, DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
 	{
 		while (nLength-- != 0U)
 			uBasis = (uBasis + (uBasis << 5U)) ^ *pSource++;
@@ -38,11 +45,140 @@ namespace DJB2A
 		return uBasis;
 	}
 
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr DJB2A_t Hash(const std::string_view strSource, DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	{
+		for (const char chSource : strSource)
+			uBasis = (uBasis + (uBasis << 5U)) ^ static_cast<std::uint8_t>(chSource);
+
+		return uBasis;
+	}
+
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] uBasis initial key of the hash generation
 	/// @returns: calculated at compile-time hash of the given string
 	consteval DJB2A_t HashConst(const char* szSource, const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
 	{
-		return (*szSource == '\0') ? uBasis : HashConst(szSource + 1, (uBasis + (uBasis << 5U)) ^ static_cast<std::uint8_t>(*szSource));
+		return Hash(szSource, uBasis);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr explicit CStream(const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept :
+			uHash(uBasis) { }
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr void Init(const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+		{
+			uHash = uBasis;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			while (nLength-- != 0U)
+				uHash = (uHash + (uHash << 5U)) ^ *pSource++;
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] constexpr DJB2A_t Final() const noexcept
+		{
+			return uHash;
+		}
+
+	private:
+		DJB2A_t uHash;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline DJB2A_t Hash(const TChar* szSource, const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline DJB2A_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uBasis), szSource);
 	}
-}
\ No newline at end of file
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval DJB2A_t HashConst(const TChar* szSource, const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval DJB2A_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const DJB2A_t uBasis = Q_HASH_DJB2A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uBasis); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct DJB2A
+	{
+		using Hash_t = DJB2A_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return Q_HASH::FOLD::HashLength32(pSource, nLength, [uSeed](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return ::DJB2A::Hash(pBuffer, uLength, Q_HASH_DJB2A_BASIS ^ uSeed); }, [uSeed] { return ::DJB2A::CStream(Q_HASH_DJB2A_BASIS ^ uSeed); });
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::DJB2A::HashConst(szSource, Q_HASH_DJB2A_BASIS ^ uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_djb2a'
+	consteval DJB2A_t operator""_djb2a(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return DJB2A::Hash(std::string_view(szSource, nLength));
+	}
+}
+#endif
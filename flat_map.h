@@ -0,0 +1,534 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t, int8_t
+#include <cstdint>
+// used: [stl] memset
+#include <cstring>
+// used: [stl] countr_zero
+#include <bit>
+// used: [stl] equal_to
+#include <functional>
+// used: [stl] operator new, align_val_t
+#include <new>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_convertible_v, has_unique_object_representations_v
+#include <type_traits>
+// used: [stl] pair, move, exchange
+#include <utility>
+
+// used: Q_HASH_CPU_X86, Q_HASH_CPU_X64, prefetch
+#include "simd.h"
+
+#if !defined(Q_HASH_FLAT_MAP_NO_SSE2) && (defined(Q_HASH_CPU_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+// used: [intrin] _mm_load_si128, _mm_cmpeq_epi8, _mm_movemask_epi8
+#include <emmintrin.h>
+
+#define Q_HASH_FLAT_MAP_SSE2
+#endif
+
+#define Q_HASH_FLAT_MAP
+
+/*
+ * OPEN-ADDRESSING FLAT HASH MAP WITH THE SIMD-SCANNED CONTROL BYTES
+ * @note: slots are split into the groups of 16, each slot has the control byte that is either empty, deleted or holds 7 bits of the key's hash, so the whole group is compared at once and the keys are touched only on the tag match
+ */
+namespace Q_HASH
+{
+	namespace DETAIL
+	{
+		// count of the slots which control bytes are scanned at once
+		inline constexpr std::size_t nGroupWidth = 16U;
+		// control bytes of the slots that don't hold a key, both have the sign bit set, while the full ones hold the 7-bit tag
+		inline constexpr std::int8_t iControlEmpty = -128;
+		inline constexpr std::int8_t iControlDeleted = -2;
+
+		/// control bytes of the single group
+		class CGroup
+		{
+		public:
+			explicit CGroup(const std::int8_t* pControls) noexcept
+			{
+			#ifdef Q_HASH_FLAT_MAP_SSE2
+				xmmControls = _mm_load_si128(reinterpret_cast<const __m128i*>(pControls));
+			#else
+				std::memcpy(arrControls, pControls, nGroupWidth);
+			#endif
+			}
+
+			/// @returns: bitmask of the slots that hold given tag
+			[[nodiscard]] std::uint32_t Match(const std::int8_t iTag) const noexcept
+			{
+			#ifdef Q_HASH_FLAT_MAP_SSE2
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(xmmControls, _mm_set1_epi8(iTag))));
+			#else
+				std::uint32_t uMask = 0U;
+				for (std::size_t i = 0U; i < nGroupWidth; ++i)
+					uMask |= static_cast<std::uint32_t>(arrControls[i] == iTag) << i;
+
+				return uMask;
+			#endif
+			}
+
+			/// @returns: bitmask of the slots that have never held a key since the last rehash
+			[[nodiscard]] std::uint32_t MatchEmpty() const noexcept
+			{
+				return Match(iControlEmpty);
+			}
+
+			/// @returns: bitmask of the slots that don't hold a key
+			[[nodiscard]] std::uint32_t MatchEmptyOrDeleted() const noexcept
+			{
+			#ifdef Q_HASH_FLAT_MAP_SSE2
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(xmmControls));
+			#else
+				std::uint32_t uMask = 0U;
+				for (std::size_t i = 0U; i < nGroupWidth; ++i)
+					uMask |= static_cast<std::uint32_t>(arrControls[i] < 0) << i;
+
+				return uMask;
+			#endif
+			}
+
+		private:
+		#ifdef Q_HASH_FLAT_MAP_SSE2
+			__m128i xmmControls;
+		#else
+			std::int8_t arrControls[nGroupWidth];
+		#endif
+		};
+	}
+
+	/// hasher policy of the map that hashes the bytes of the string keys or the object representation of the other keys
+	/// @tparam THash default-constructible function object that takes the buffer and its length in bytes and returns the integral hash of it, e.g. lambda that calls 'MURMUR2_64::Hash'
+	template <typename THash>
+	struct CBytesHasher
+	{
+		template <typename T>
+		std::uint64_t operator()(const T& key) const noexcept
+		{
+			if constexpr (std::is_convertible_v<const T&, std::string_view>)
+			{
+				const std::string_view strKey = key;
+				return static_cast<std::uint64_t>(THash{}(reinterpret_cast<const std::uint8_t*>(strKey.data()), strKey.size()));
+			}
+			else
+			{
+				static_assert(std::has_unique_object_representations_v<T>, "key must be a string or have no padding bits to be hashed by bytes");
+				return static_cast<std::uint64_t>(THash{}(reinterpret_cast<const std::uint8_t*>(&key), sizeof(T)));
+			}
+		}
+	};
+
+	/// @tparam THasher function object that returns the integral hash of the key, the low 7 bits are used as the tag and the rest of bits selects the group
+	/// @tparam TEqual function object that compares the keys for equality
+	template <typename TKey, typename TValue, typename THasher, typename TEqual = std::equal_to<TKey>>
+	class CFlatMap
+	{
+	public:
+		struct Slot_t
+		{
+			/// construct the key from the first argument and the value in-place from the rest of them, the value is value-initialized when there are none
+			template <typename TKeyArgument, typename... TArgs>
+			Slot_t(TKeyArgument&& keyArgument, TArgs&&... args) :
+				key(std::forward<TKeyArgument>(keyArgument)), value(std::forward<TArgs>(args)...) { }
+
+			TKey key;
+			TValue value;
+		};
+
+		CFlatMap() noexcept = default;
+
+		/// @param[in] nCount count of the elements to allocate memory for
+		explicit CFlatMap(const std::size_t nCount)
+		{
+			Reserve(nCount);
+		}
+
+		~CFlatMap()
+		{
+			Destroy();
+		}
+
+		CFlatMap(const CFlatMap&) = delete;
+		CFlatMap& operator=(const CFlatMap&) = delete;
+
+		CFlatMap(CFlatMap&& other) noexcept :
+			pControls(std::exchange(other.pControls, nullptr)), pSlots(std::exchange(other.pSlots, nullptr)), nCapacity(std::exchange(other.nCapacity, 0U)), nSize(std::exchange(other.nSize, 0U)), nGrowthLeft(std::exchange(other.nGrowthLeft, 0U)) { }
+
+		CFlatMap& operator=(CFlatMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Destroy();
+				pControls = std::exchange(other.pControls, nullptr);
+				pSlots = std::exchange(other.pSlots, nullptr);
+				nCapacity = std::exchange(other.nCapacity, 0U);
+				nSize = std::exchange(other.nSize, 0U);
+				nGrowthLeft = std::exchange(other.nGrowthLeft, 0U);
+			}
+
+			return *this;
+		}
+
+		/* @section: get */
+		/// @returns: count of the stored elements
+		[[nodiscard]] std::size_t Size() const noexcept
+		{
+			return nSize;
+		}
+
+		[[nodiscard]] bool IsEmpty() const noexcept
+		{
+			return nSize == 0U;
+		}
+
+		/// @returns: count of the allocated slots
+		[[nodiscard]] std::size_t Capacity() const noexcept
+		{
+			return nCapacity;
+		}
+
+		/// @returns: hash of the key, as it is used by the map
+		[[nodiscard]] std::uint64_t Hash(const TKey& key) const noexcept
+		{
+			return static_cast<std::uint64_t>(hasher(key));
+		}
+
+		/// @returns: pointer to the value of the given key if it is stored, null otherwise
+		[[nodiscard]] TValue* Find(const TKey& key) noexcept
+		{
+			return Find(key, Hash(key));
+		}
+
+		/// @param[in] ullHash precomputed hash of the key, e.g. by 'HashConst' at compile-time, must be equal to the one the hasher policy returns
+		/// @returns: pointer to the value of the given key if it is stored, null otherwise
+		[[nodiscard]] TValue* Find(const TKey& key, const std::uint64_t ullHash) noexcept
+		{
+			const std::size_t nIndex = FindIndex(key, ullHash);
+			return (nIndex != nInvalidIndex) ? &pSlots[nIndex].value : nullptr;
+		}
+
+		[[nodiscard]] const TValue* Find(const TKey& key) const noexcept
+		{
+			return const_cast<CFlatMap*>(this)->Find(key);
+		}
+
+		[[nodiscard]] const TValue* Find(const TKey& key, const std::uint64_t ullHash) const noexcept
+		{
+			return const_cast<CFlatMap*>(this)->Find(key, ullHash);
+		}
+
+		[[nodiscard]] bool Contains(const TKey& key) const noexcept
+		{
+			return Find(key) != nullptr;
+		}
+
+		/// find many keys at once, where the memory of all their groups is requested before the first one is probed, so the cache misses overlap
+		/// @param[in] pKeys array of the keys to find
+		/// @param[in] pHashes array of the precomputed hashes of each key, or null to hash them
+		/// @param[in] nCount count of the keys
+		/// @param[out] ppResults array that receives pointer to the value of each key if it is stored, null otherwise
+		void FindBatch(const TKey* pKeys, const std::uint64_t* pHashes, const std::size_t nCount, TValue** ppResults) noexcept
+		{
+			std::uint64_t arrHashes[nBatchWindow];
+
+			for (std::size_t nOffset = 0U; nOffset < nCount; nOffset += nBatchWindow)
+			{
+				const std::size_t nWindow = (nCount - nOffset < nBatchWindow) ? nCount - nOffset : nBatchWindow;
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+				{
+					arrHashes[i] = (pHashes != nullptr) ? pHashes[nOffset + i] : Hash(pKeys[nOffset + i]);
+
+					if (nCapacity != 0U)
+						SIMD::Prefetch(pControls + GetFirstGroup(arrHashes[i]) * DETAIL::nGroupWidth);
+				}
+
+				// request the slot of the first tag match, by then the control bytes are likely to have arrived
+				if (nCapacity != 0U)
+				{
+					for (std::size_t i = 0U; i < nWindow; ++i)
+					{
+						const std::size_t nFirstSlot = GetFirstGroup(arrHashes[i]) * DETAIL::nGroupWidth;
+						if (const std::uint32_t uMatches = DETAIL::CGroup(pControls + nFirstSlot).Match(GetTag(arrHashes[i])); uMatches != 0U)
+							SIMD::Prefetch(pSlots + nFirstSlot + static_cast<std::size_t>(std::countr_zero(uMatches)));
+					}
+				}
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+					ppResults[nOffset + i] = Find(pKeys[nOffset + i], arrHashes[i]);
+			}
+		}
+
+		/// @param[in] pKeys array of the keys to find
+		/// @param[in] nCount count of the keys
+		/// @param[out] ppResults array that receives pointer to the value of each key if it is stored, null otherwise
+		void FindBatch(const TKey* pKeys, const std::size_t nCount, TValue** ppResults) noexcept
+		{
+			FindBatch(pKeys, nullptr, nCount, ppResults);
+		}
+
+		/// invoke the callback with the key and the value of each stored element, in unspecified order
+		template <typename TCallback>
+		void ForEach(TCallback&& fnCallback)
+		{
+			for (std::size_t i = 0U; i < nCapacity; ++i)
+			{
+				if (pControls[i] >= 0)
+					fnCallback(static_cast<const TKey&>(pSlots[i].key), pSlots[i].value);
+			}
+		}
+
+		/* @section: set */
+		/// insert the element if the key isn't stored yet
+		/// @returns: pointer to the value of the key and true if the element has been inserted, false if the key was already stored
+		std::pair<TValue*, bool> Insert(TKey key, TValue value)
+		{
+			const std::uint64_t ullHash = Hash(key);
+			return Insert(std::move(key), std::move(value), ullHash);
+		}
+
+		/// @param[in] ullHash precomputed hash of the key, must be equal to the one the hasher policy returns
+		std::pair<TValue*, bool> Insert(TKey key, TValue value, const std::uint64_t ullHash)
+		{
+			if (const std::size_t nIndex = FindIndex(key, ullHash); nIndex != nInvalidIndex)
+				return { &pSlots[nIndex].value, false };
+
+			return { EmplaceNew(ullHash, std::move(key), std::move(value)), true };
+		}
+
+		/// insert the element which value is constructed in-place from the given arguments if the key isn't stored yet, neither the key is copied nor the value is constructed otherwise
+		/// @returns: pointer to the value of the key and true if the element has been inserted, false if the key was already stored
+		template <typename... TArgs>
+		std::pair<TValue*, bool> TryEmplace(const TKey& key, TArgs&&... args)
+		{
+			const std::uint64_t ullHash = Hash(key);
+			if (const std::size_t nIndex = FindIndex(key, ullHash); nIndex != nInvalidIndex)
+				return { &pSlots[nIndex].value, false };
+
+			return { EmplaceNew(ullHash, key, std::forward<TArgs>(args)...), true };
+		}
+
+		/// @returns: reference to the value of the key, inserting the value-initialized one if the key isn't stored yet
+		TValue& operator[](const TKey& key)
+		{
+			return *TryEmplace(key).first;
+		}
+
+		/// @returns: true if the key has been removed, false if it wasn't stored
+		bool Erase(const TKey& key)
+		{
+			return Erase(key, Hash(key));
+		}
+
+		/// @param[in] ullHash precomputed hash of the key, must be equal to the one the hasher policy returns
+		bool Erase(const TKey& key, const std::uint64_t ullHash)
+		{
+			const std::size_t nIndex = FindIndex(key, ullHash);
+			if (nIndex == nInvalidIndex)
+				return false;
+
+			pSlots[nIndex].~Slot_t();
+			--nSize;
+
+			// the probing stops at the group that has an empty slot, so the slot in such group doesn't have to keep the probe sequence going
+			if (DETAIL::CGroup(pControls + (nIndex & ~(DETAIL::nGroupWidth - 1U))).MatchEmpty() != 0U)
+			{
+				pControls[nIndex] = DETAIL::iControlEmpty;
+				++nGrowthLeft;
+			}
+			else
+				pControls[nIndex] = DETAIL::iControlDeleted;
+
+			return true;
+		}
+
+		/// remove all elements, keeping the allocated memory
+		void Clear() noexcept
+		{
+			DestroySlots();
+
+			if (nCapacity != 0U)
+				std::memset(pControls, DETAIL::iControlEmpty, nCapacity);
+
+			nSize = 0U;
+			nGrowthLeft = GetMaxLoad(nCapacity);
+		}
+
+		/// allocate memory for at least given count of elements
+		void Reserve(const std::size_t nCount)
+		{
+			std::size_t nNewCapacity = DETAIL::nGroupWidth;
+			while (GetMaxLoad(nNewCapacity) < nCount)
+				nNewCapacity <<= 1U;
+
+			if (nNewCapacity > nCapacity)
+				Resize(nNewCapacity);
+		}
+
+	private:
+		// count of the keys which memory is requested at once by the batched lookup
+		static constexpr std::size_t nBatchWindow = 16U;
+		static constexpr std::size_t nInvalidIndex = ~static_cast<std::size_t>(0U);
+
+		/// @returns: maximal count of the elements in the table of the given capacity, 7/8 of it
+		static constexpr std::size_t GetMaxLoad(const std::size_t nSlots) noexcept
+		{
+			return nSlots - nSlots / 8U;
+		}
+
+		static constexpr std::int8_t GetTag(const std::uint64_t ullHash) noexcept
+		{
+			return static_cast<std::int8_t>(ullHash & 0x7F);
+		}
+
+		[[nodiscard]] std::size_t GetFirstGroup(const std::uint64_t ullHash) const noexcept
+		{
+			return static_cast<std::size_t>(ullHash >> 7U) & (nCapacity / DETAIL::nGroupWidth - 1U);
+		}
+
+		/// @returns: index of the slot that holds given key, or invalid index if not found
+		[[nodiscard]] std::size_t FindIndex(const TKey& key, const std::uint64_t ullHash) const noexcept
+		{
+			if (nCapacity == 0U)
+				return nInvalidIndex;
+
+			const std::int8_t iTag = GetTag(ullHash);
+			const std::size_t nGroupMask = nCapacity / DETAIL::nGroupWidth - 1U;
+
+			// triangular probing, visits each group once when the count of groups is a power of two
+			for (std::size_t nGroup = GetFirstGroup(ullHash), nStep = 1U;; nGroup = (nGroup + nStep++) & nGroupMask)
+			{
+				const std::size_t nFirstSlot = nGroup * DETAIL::nGroupWidth;
+				const DETAIL::CGroup group(pControls + nFirstSlot);
+
+				for (std::uint32_t uMatches = group.Match(iTag); uMatches != 0U; uMatches &= uMatches - 1U)
+				{
+					const std::size_t nIndex = nFirstSlot + static_cast<std::size_t>(std::countr_zero(uMatches));
+					if (equal(pSlots[nIndex].key, key))
+						return nIndex;
+				}
+
+				// the key would have been inserted to this group
+				if (group.MatchEmpty() != 0U)
+					return nInvalidIndex;
+			}
+		}
+
+		/// @returns: index of the first free slot on the probe sequence of the given hash
+		[[nodiscard]] std::size_t FindInsertIndex(const std::uint64_t ullHash) const noexcept
+		{
+			const std::size_t nGroupMask = nCapacity / DETAIL::nGroupWidth - 1U;
+
+			for (std::size_t nGroup = GetFirstGroup(ullHash), nStep = 1U;; nGroup = (nGroup + nStep++) & nGroupMask)
+			{
+				const std::size_t nFirstSlot = nGroup * DETAIL::nGroupWidth;
+
+				if (const std::uint32_t uFree = DETAIL::CGroup(pControls + nFirstSlot).MatchEmptyOrDeleted(); uFree != 0U)
+					return nFirstSlot + static_cast<std::size_t>(std::countr_zero(uFree));
+			}
+		}
+
+		/// construct the element of the key that isn't stored yet
+		/// @returns: pointer to the constructed value
+		template <typename TKeyArgument, typename... TArgs>
+		TValue* EmplaceNew(const std::uint64_t ullHash, TKeyArgument&& key, TArgs&&... args)
+		{
+			std::size_t nIndex = (nCapacity != 0U) ? FindInsertIndex(ullHash) : nInvalidIndex;
+
+			// reusing the deleted slot doesn't take the growth
+			if (nIndex == nInvalidIndex || (nGrowthLeft == 0U && pControls[nIndex] == DETAIL::iControlEmpty))
+			{
+				Grow();
+				nIndex = FindInsertIndex(ullHash);
+			}
+
+			// the slot is marked as used only once the element is constructed, so the table stays consistent if the construction throws
+			::new (static_cast<void*>(&pSlots[nIndex])) Slot_t(std::forward<TKeyArgument>(key), std::forward<TArgs>(args)...);
+
+			if (pControls[nIndex] == DETAIL::iControlEmpty)
+				--nGrowthLeft;
+
+			pControls[nIndex] = GetTag(ullHash);
+			++nSize;
+			return &pSlots[nIndex].value;
+		}
+
+		void Grow()
+		{
+			// when most of the used growth is taken by the deleted slots, rehashing in place is enough
+			if (nCapacity != 0U && nSize < GetMaxLoad(nCapacity) / 2U)
+				Resize(nCapacity);
+			else
+				Resize(nCapacity != 0U ? nCapacity * 2U : DETAIL::nGroupWidth);
+		}
+
+		void Resize(const std::size_t nNewCapacity)
+		{
+			std::int8_t* pOldControls = std::exchange(pControls, static_cast<std::int8_t*>(::operator new(nNewCapacity, std::align_val_t(DETAIL::nGroupWidth))));
+			Slot_t* pOldSlots = std::exchange(pSlots, static_cast<Slot_t*>(::operator new(nNewCapacity * sizeof(Slot_t), std::align_val_t(alignof(Slot_t)))));
+			const std::size_t nOldCapacity = std::exchange(nCapacity, nNewCapacity);
+
+			std::memset(pControls, DETAIL::iControlEmpty, nCapacity);
+			nGrowthLeft = GetMaxLoad(nCapacity) - nSize;
+
+			for (std::size_t i = 0U; i < nOldCapacity; ++i)
+			{
+				if (pOldControls[i] < 0)
+					continue;
+
+				const std::uint64_t ullHash = Hash(pOldSlots[i].key);
+				const std::size_t nIndex = FindInsertIndex(ullHash);
+
+				pControls[nIndex] = GetTag(ullHash);
+				::new (static_cast<void*>(&pSlots[nIndex])) Slot_t(std::move(pOldSlots[i]));
+				pOldSlots[i].~Slot_t();
+			}
+
+			if (nOldCapacity != 0U)
+			{
+				::operator delete(pOldControls, std::align_val_t(DETAIL::nGroupWidth));
+				::operator delete(pOldSlots, std::align_val_t(alignof(Slot_t)));
+			}
+		}
+
+		void DestroySlots() noexcept
+		{
+			if constexpr (!std::is_trivially_destructible_v<Slot_t>)
+			{
+				for (std::size_t i = 0U; i < nCapacity; ++i)
+				{
+					if (pControls[i] >= 0)
+						pSlots[i].~Slot_t();
+				}
+			}
+		}
+
+		void Destroy() noexcept
+		{
+			if (nCapacity == 0U)
+				return;
+
+			DestroySlots();
+			::operator delete(pControls, std::align_val_t(DETAIL::nGroupWidth));
+			::operator delete(pSlots, std::align_val_t(alignof(Slot_t)));
+
+			pControls = nullptr;
+			pSlots = nullptr;
+			nCapacity = 0U;
+			nSize = 0U;
+			nGrowthLeft = 0U;
+		}
+
+		std::int8_t* pControls = nullptr;
+		Slot_t* pSlots = nullptr;
+		std::size_t nCapacity = 0U;
+		std::size_t nSize = 0U;
+		// count of the empty slots that can be taken before the table must grow
+		std::size_t nGrowthLeft = 0U;
+		[[no_unique_address]] THasher hasher = { };
+		[[no_unique_address]] TEqual equal = { };
+	};
+}
@@ -1,6 +1,22 @@
 #pragma once
+// used: [stl] size_t
+#include <cstddef>
 // used: [stl] uint32_t
 #include <cstdint>
+// used: [stl] string_view
+#include <string_view>
+
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst, hashlength32
+#include "fold.h"
+
+#ifndef Q_HASH_FNV1A_NO_AVX2
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch, transpose, loadblocks32, loadtail
+#include "simd.h"
+
+#ifdef Q_HASH_CPU_X86
+#define Q_HASH_FNV1A_AVX2
+#endif
+#endif
 
 #define Q_HASH_FNV1A
 
@@ -19,11 +35,110 @@ using FNV1A_t = std::uint32_t;
  */
 namespace FNV1A
 {
+#ifdef Q_HASH_FNV1A_AVX2
+	namespace DETAIL
+	{
+		// count of the vector lane groups processed at once, so their multiplication latencies overlap
+		inline constexpr std::size_t nBatchGroups = 2U;
+		// count of the buffers processed at once by the vectorized batch
+		inline constexpr std::size_t nBatchLanes = nBatchGroups * 8U;
+
+		/// @returns: hash state after mixing the given count of the lowest bytes of the each lane's block
+		Q_HASH_TARGET("avx2") inline __m256i MixBytes(__m256i ymmHash, __m256i ymmBlock, const int nBytes) noexcept
+		{
+			const __m256i ymmPrime = _mm256_set1_epi32(static_cast<int>(Q_HASH_FNV1A_PRIME));
+			const __m256i ymmByteMask = _mm256_set1_epi32(0xFF);
+
+			for (int i = 0; i < nBytes; ++i)
+			{
+				ymmHash = _mm256_mullo_epi32(_mm256_xor_si256(ymmHash, _mm256_and_si256(ymmBlock, ymmByteMask)), ymmPrime);
+				ymmBlock = _mm256_srli_epi32(ymmBlock, 8);
+			}
+
+			return ymmHash;
+		}
+
+		/// generate hashes of the lanes with the each hash chain in the separate vector lane, where lanes that have run out of bytes are masked out
+		/// @returns: false if some of the buffers are too long to be processed by vector lanes, true otherwise
+		Q_HASH_TARGET("avx2") inline bool HashLanesAVX2(const std::uint8_t* const* ppSources, const std::size_t* pLengths, FNV1A_t* pResults, const FNV1A_t uBasis) noexcept
+		{
+			std::int32_t arrLengths[nBatchLanes], arrTails[nBatchLanes];
+			std::size_t nMaxBodyLength = 0U;
+
+			for (std::size_t nLane = 0U; nLane < nBatchLanes; ++nLane)
+			{
+				// lengths are kept in the signed 32-bit lanes, the longer buffers are left to the scalar batch
+				const std::size_t nLength = pLengths[nLane];
+				if (nLength > 0x7FFFFFFF)
+					return false;
+
+				arrLengths[nLane] = static_cast<std::int32_t>(nLength);
+
+				arrTails[nLane] = static_cast<std::int32_t>(Q_HASH::SIMD::LoadTail<std::uint32_t>(ppSources[nLane], nLength));
+
+				const std::size_t nBodyLength = nLength & ~static_cast<std::size_t>(3U);
+
+				nMaxBodyLength = (nBodyLength > nMaxBodyLength) ? nBodyLength : nMaxBodyLength;
+			}
+
+			__m256i arrLengthsVector[nBatchGroups], arrHashes[nBatchGroups];
+			for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+			{
+				arrLengthsVector[nGroup] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrLengths + nGroup * 8U));
+				arrHashes[nGroup] = _mm256_set1_epi32(static_cast<int>(uBasis));
+			}
+
+			// process 8 blocks of 4 bytes of each lane per iteration
+			for (std::size_t nOffset = 0U; nOffset < nMaxBodyLength; nOffset += sizeof(__m256i))
+			{
+				__m256i arrRows[nBatchGroups][8];
+				for (std::size_t nLane = 0U; nLane < nBatchLanes; ++nLane)
+				{
+					const int nRemainingBlocks = (arrLengths[nLane] - static_cast<int>(nOffset)) >> 2;
+					arrRows[nLane / 8U][nLane % 8U] = Q_HASH::SIMD::LoadBlocks32(nRemainingBlocks > 0 ? ppSources[nLane] + nOffset : ppSources[nLane], nRemainingBlocks);
+				}
+
+				for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+					Q_HASH::SIMD::Transpose(arrRows[nGroup]);
+
+				for (std::size_t nBlock = 0U; nBlock < 8U; ++nBlock)
+				{
+					const __m256i ymmOffset = _mm256_set1_epi32(static_cast<int>(nOffset + nBlock * 4U + 3U));
+
+					for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+					{
+						// lanes that still have a whole block at this offset
+						const __m256i ymmActive = _mm256_cmpgt_epi32(arrLengthsVector[nGroup], ymmOffset);
+						arrHashes[nGroup] = _mm256_blendv_epi8(arrHashes[nGroup], MixBytes(arrHashes[nGroup], arrRows[nGroup][nBlock], 4), ymmActive);
+					}
+				}
+			}
+
+			// process the remaining bytes
+			for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+			{
+				const __m256i ymmTailLengths = _mm256_and_si256(arrLengthsVector[nGroup], _mm256_set1_epi32(3));
+				const __m256i ymmTail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrTails + nGroup * 8U));
+
+				for (int i = 0; i < 3; ++i)
+				{
+					const __m256i ymmActive = _mm256_cmpgt_epi32(ymmTailLengths, _mm256_set1_epi32(i));
+					arrHashes[nGroup] = _mm256_blendv_epi8(arrHashes[nGroup], MixBytes(arrHashes[nGroup], _mm256_srli_epi32(ymmTail, i * 8), 1), ymmActive);
+				}
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pResults + nGroup * 8U), arrHashes[nGroup]);
+			}
+
+			return true;
+		}
+	}
+#endif
+
 	/// @param[in] pSource buffer for which the hash will be generated
 	/// @param[in] nLength length of the source buffer in bytes
 	/// @param[in] uBasis initial key of the hash generation
 	/// @returns: calculated hash of the given buffer
-	inline FNV1A_t Hash(const std::uint8_t* pSource, std::uint32_t nLength, FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	constexpr FNV1A_t Hash(const std::uint8_t* pSource, std::uint32_t nLength, FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
 	{
 		while (nLength-- != 0U)
 			uBasis = (uBasis ^ *pSource++) * Q_HASH_FNV1A_PRIME;
@@ -42,11 +157,192 @@ namespace FNV1A
 		return uBasis;
 	}
 
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr FNV1A_t Hash(const std::string_view strSource, FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+		for (const char chSource : strSource)
+			uBasis = (uBasis ^ static_cast<std::uint8_t>(chSource)) * Q_HASH_FNV1A_PRIME;
+
+		return uBasis;
+	}
+
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] uBasis initial key of the hash generation
 	/// @returns: calculated at compile-time hash of the given string
 	consteval FNV1A_t HashConst(const char* szSource, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
 	{
-		return (*szSource == '\0') ? uBasis : HashConst(szSource + 1, (uBasis ^ static_cast<std::uint8_t>(*szSource)) * Q_HASH_FNV1A_PRIME);
+		return Hash(szSource, uBasis);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr explicit CStream(const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept :
+			uHash(uBasis) { }
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uBasis initial key of the hash generation
+		constexpr void Init(const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+		{
+			uHash = uBasis;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			while (nLength-- != 0U)
+				uHash = (uHash ^ *pSource++) * Q_HASH_FNV1A_PRIME;
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] constexpr FNV1A_t Final() const noexcept
+		{
+			return uHash;
+		}
+
+	private:
+		FNV1A_t uHash;
+	};
+
+	/* @section: batch */
+	namespace DETAIL
+	{
+		inline void HashBatchScalar(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, FNV1A_t* pResults, const FNV1A_t uBasis) noexcept
+		{
+			// independent calls already overlap in the out-of-order execution, so the scalar chains are not interleaved manually
+			while (nCount-- != 0U)
+				*pResults++ = Q_HASH::FOLD::HashLength32(*ppSources++, *pLengths++, [uBasis](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return Hash(pBuffer, uLength, uBasis); }, [uBasis] { return CStream(uBasis); });
+		}
+
+	#ifdef Q_HASH_FNV1A_AVX2
+		inline void HashBatchAVX2(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, FNV1A_t* pResults, const FNV1A_t uBasis) noexcept
+		{
+			for (; nCount >= nBatchLanes && HashLanesAVX2(ppSources, pLengths, pResults, uBasis); nCount -= nBatchLanes)
+			{
+				ppSources += nBatchLanes;
+				pLengths += nBatchLanes;
+				pResults += nBatchLanes;
+			}
+
+			HashBatchScalar(ppSources, pLengths, nCount, pResults, uBasis);
+		}
+
+		using HashBatch_t = void(const std::uint8_t* const*, const std::size_t*, std::size_t, FNV1A_t*, FNV1A_t) noexcept;
+
+		inline HashBatch_t* ResolveHashBatch() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &HashBatchAVX2;
+
+			return &HashBatchScalar;
+		}
+
+		using HashBatchDispatch_t = Q_HASH::CPU::CDispatch<HashBatch_t, &ResolveHashBatch>;
+	#endif
+	}
+
+	/// generate hashes of the many independent buffers at once, faster than hashing them one by one
+	/// @param[in] ppSources array of the buffers for which the hashes will be generated
+	/// @param[in] pLengths array of the length of each buffer in bytes
+	/// @param[in] nCount count of the buffers
+	/// @param[out] pResults array that receives calculated hash of each buffer, equal to the 'Hash' one
+	/// @param[in] uBasis initial key of the hash generation
+	inline void HashBatch(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, FNV1A_t* pResults, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+	#ifdef Q_HASH_FNV1A_AVX2
+		DETAIL::HashBatchDispatch_t::Call(ppSources, pLengths, nCount, pResults, uBasis);
+	#else
+		DETAIL::HashBatchScalar(ppSources, pLengths, nCount, pResults, uBasis);
+	#endif
+	}
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline FNV1A_t Hash(const TChar* szSource, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline FNV1A_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval FNV1A_t HashConst(const TChar* szSource, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval FNV1A_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const FNV1A_t uBasis = Q_HASH_FNV1A_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uBasis); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct FNV1A
+	{
+		using Hash_t = FNV1A_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return Q_HASH::FOLD::HashLength32(pSource, nLength, [uSeed](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return ::FNV1A::Hash(pBuffer, uLength, Q_HASH_FNV1A_BASIS ^ uSeed); }, [uSeed] { return ::FNV1A::CStream(Q_HASH_FNV1A_BASIS ^ uSeed); });
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::FNV1A::HashConst(szSource, Q_HASH_FNV1A_BASIS ^ uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_fnv1a'
+	consteval FNV1A_t operator""_fnv1a(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return FNV1A::Hash(std::string_view(szSource, nLength));
 	}
 }
+#endif
@@ -3,6 +3,11 @@
 #include <cstddef>
 // used: [stl] uint64_t
 #include <cstdint>
+// used: [stl] string_view
+#include <string_view>
+
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
 
 #define Q_HASH_FNV1A_64
 
@@ -27,7 +32,7 @@ namespace FNV1A_64
 	/// @param[in] nLength length of the source buffer in bytes
 	/// @param[in] ullBasis initial key of the hash generation
 	/// @returns: calculated hash of the given buffer
-	inline FNV1A64_t Hash(const std::uint8_t* pSource, std::size_t nLength, FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	constexpr FNV1A64_t Hash(const std::uint8_t* pSource, std::size_t nLength, FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
 	{
 		while (nLength-- != 0U)
 			ullBasis = (ullBasis ^ *pSource++) * Q_HASH_FNV1A_64_PRIME;
@@ -46,11 +51,139 @@ namespace FNV1A_64
 		return ullBasis;
 	}
 
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr FNV1A64_t Hash(const std::string_view strSource, FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	{
+		for (const char chSource : strSource)
+			ullBasis = (ullBasis ^ static_cast<std::uint8_t>(chSource)) * Q_HASH_FNV1A_64_PRIME;
+
+		return ullBasis;
+	}
+
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] ullBasis initial key of the hash generation
 	/// @returns: calculated at compile-time hash of the given string
 	consteval FNV1A64_t HashConst(const char* szSource, const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
 	{
-		return (*szSource == '\0') ? ullBasis : HashConst(szSource + 1, (ullBasis ^ static_cast<std::uint8_t>(*szSource)) * Q_HASH_FNV1A_64_PRIME);
+		return Hash(szSource, ullBasis);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] ullBasis initial key of the hash generation
+		constexpr explicit CStream(const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept :
+			uHash(ullBasis) { }
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] ullBasis initial key of the hash generation
+		constexpr void Init(const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+		{
+			uHash = ullBasis;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			uHash = Hash(pSource, nLength, uHash);
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] constexpr FNV1A64_t Final() const noexcept
+		{
+			return uHash;
+		}
+
+	private:
+		FNV1A64_t uHash;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline FNV1A64_t Hash(const TChar* szSource, const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(ullBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline FNV1A64_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(ullBasis), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval FNV1A64_t HashConst(const TChar* szSource, const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullBasis); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullBasis initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval FNV1A64_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const FNV1A64_t ullBasis = Q_HASH_FNV1A_64_BASIS) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullBasis](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullBasis); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct FNV1A_64
+	{
+		using Hash_t = FNV1A64_t;
+		static constexpr bool bAvalanching = false;
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::FNV1A_64::Hash(pSource, nLength, Q_HASH_FNV1A_64_BASIS ^ uSeed);
+		}
+
+		/// @param[in] uSeed value that is mixed into the initial key, zero gives the default one
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::FNV1A_64::HashConst(szSource, Q_HASH_FNV1A_64_BASIS ^ uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_fnv1a_64'
+	consteval FNV1A64_t operator""_fnv1a_64(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return FNV1A_64::Hash(std::string_view(szSource, nLength));
 	}
 }
+#endif
@@ -0,0 +1,232 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uintptr_t
+#include <cstdint>
+// used: [stl] countr_zero
+#include <bit>
+// used: [stl] is_same_v
+#include <type_traits>
+
+// used: Q_HASH_SIMD_SSE2, Q_HASH_SIMD_SCAN_STRING, scanstring
+#include "simd.h"
+
+/*
+ * NARROWING AND CASE FOLDING OF THE CHARACTER STRINGS
+ * @note: each character is narrowed to its low byte and then, on request, the ASCII uppercase letters are turned to lowercase, so the wide and folded overloads of every algorithm give the same hash as the narrow lowercase copy of the string would
+ */
+namespace Q_HASH
+{
+	/// tag that selects the ASCII case-insensitive overloads, e.g. 'MURMUR3::Hash(szName, Q_HASH::IGNORE_CASE)'
+	struct IgnoreCase_t
+	{
+		explicit constexpr IgnoreCase_t() noexcept = default;
+	};
+
+	inline constexpr IgnoreCase_t IGNORE_CASE { };
+}
+
+namespace Q_HASH::FOLD
+{
+	template <typename T>
+	inline constexpr bool IsWideCharacter = std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+	template <typename T>
+	inline constexpr bool IsCharacter = std::is_same_v<T, char> || IsWideCharacter<T>;
+
+	// count of the folded bytes that are passed at once to the consumer
+	inline constexpr std::size_t nChunkLength = 256U;
+
+	/// @returns: character narrowed to its low byte and optionally lowercased
+	template <bool LOWER_CASE, typename TChar>
+	constexpr std::uint8_t FoldCharacter(const TChar chSource) noexcept
+	{
+		const std::uint8_t uByte = static_cast<std::uint8_t>(chSource);
+		if constexpr (LOWER_CASE)
+		{
+			if (static_cast<std::uint8_t>(uByte - 'A') < 26U)
+				return uByte | 0x20;
+		}
+
+		return uByte;
+	}
+
+#ifdef Q_HASH_SIMD_SSE2
+	/// @returns: characters of the 16-byte chunk narrowed to their low bytes, packed to the beginning of the vector
+	template <typename TChar>
+	inline __m128i NarrowChunk(const __m128i xmmChunk) noexcept
+	{
+		if constexpr (sizeof(TChar) == sizeof(std::uint16_t))
+			return _mm_packus_epi16(_mm_and_si128(xmmChunk, _mm_set1_epi16(0xFF)), _mm_setzero_si128());
+		else if constexpr (sizeof(TChar) == sizeof(std::uint32_t))
+		{
+			const __m128i xmmWords = _mm_packs_epi32(_mm_and_si128(xmmChunk, _mm_set1_epi32(0xFF)), _mm_setzero_si128());
+			return _mm_packus_epi16(xmmWords, _mm_setzero_si128());
+		}
+		else
+			return xmmChunk;
+	}
+
+	/// @returns: bytes with the ASCII uppercase letters turned to lowercase
+	inline __m128i LowerCaseChunk(const __m128i xmmBytes) noexcept
+	{
+		// move 'A'..'Z' to the bottom of the signed range, so the single comparison selects them
+		const __m128i xmmUpperCase = _mm_cmplt_epi8(_mm_add_epi8(xmmBytes, _mm_set1_epi8(0x80 - 'A')), _mm_set1_epi8(-0x80 + 26));
+		return _mm_or_si128(xmmBytes, _mm_and_si128(xmmUpperCase, _mm_set1_epi8(0x20)));
+	}
+
+	/// @returns: mask of the characters of the chunk that are equal to zero, with a bit per byte
+	template <typename TChar>
+	inline std::uint32_t TerminatorMask(const __m128i xmmChunk) noexcept
+	{
+		if constexpr (sizeof(TChar) == sizeof(std::uint16_t))
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(xmmChunk, _mm_setzero_si128())));
+		else if constexpr (sizeof(TChar) == sizeof(std::uint32_t))
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(xmmChunk, _mm_setzero_si128())));
+		else
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(xmmChunk, _mm_setzero_si128())));
+	}
+#endif
+
+	/// walk the null-terminated string once, narrowing and optionally lowercasing it by the aligned 16-byte chunks that never cross the page boundary
+	/// @param[in] fnFolded callable as 'fnFolded(pFolded, nFoldedLength)' with each next chunk of the folded string, in order
+	/// @returns: length of the string in characters
+	template <bool LOWER_CASE, typename TChar, typename TCallback>
+	inline std::size_t FoldString(const TChar* szSource, TCallback&& fnFolded) noexcept
+	{
+		// extra room for the whole vector stored past the last folded byte
+		alignas(16) std::uint8_t arrFolded[nChunkLength + 16U];
+		std::size_t nFoldedLength = 0U;
+		const TChar* pSource = szSource;
+
+	#ifdef Q_HASH_SIMD_SCAN_STRING
+		// the characters of the misaligned string may straddle the chunks, so such strings fall back to the scalar loop
+		if (reinterpret_cast<std::uintptr_t>(szSource) % sizeof(TChar) == 0U)
+		{
+			// the characters before the first and from the last whole chunk, at most 15 of them
+			const auto FoldScalar = [&](const TChar* pEnd)
+			{
+				for (; pSource < pEnd; ++pSource)
+					arrFolded[nFoldedLength++] = FoldCharacter<LOWER_CASE>(*pSource);
+			};
+
+			const TChar* pChunk = reinterpret_cast<const TChar*>(reinterpret_cast<std::uintptr_t>(szSource) & ~static_cast<std::uintptr_t>(15U));
+
+			// mask out the bytes of the first chunk that precede the string
+			std::uint32_t uMask = TerminatorMask<TChar>(_mm_load_si128(reinterpret_cast<const __m128i*>(pChunk))) & (~0U << (reinterpret_cast<const std::uint8_t*>(szSource) - reinterpret_cast<const std::uint8_t*>(pChunk)));
+			if (uMask == 0U)
+			{
+				pChunk += sizeof(__m128i) / sizeof(TChar);
+				FoldScalar(pChunk);
+
+				for (;;)
+				{
+					const __m128i xmmChunk = _mm_load_si128(reinterpret_cast<const __m128i*>(pChunk));
+					uMask = TerminatorMask<TChar>(xmmChunk);
+					if (uMask != 0U)
+						break;
+
+					__m128i xmmFolded = NarrowChunk<TChar>(xmmChunk);
+					if constexpr (LOWER_CASE)
+						xmmFolded = LowerCaseChunk(xmmFolded);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(arrFolded + nFoldedLength), xmmFolded);
+					nFoldedLength += sizeof(__m128i) / sizeof(TChar);
+					pChunk += sizeof(__m128i) / sizeof(TChar);
+					pSource = pChunk;
+
+					if (nFoldedLength >= nChunkLength)
+					{
+						fnFolded(static_cast<const std::uint8_t*>(arrFolded), nFoldedLength);
+						nFoldedLength = 0U;
+					}
+				}
+			}
+
+			const TChar* pEnd = pChunk + std::countr_zero(uMask) / sizeof(TChar);
+			FoldScalar(pEnd);
+			fnFolded(static_cast<const std::uint8_t*>(arrFolded), nFoldedLength);
+			return static_cast<std::size_t>(pEnd - szSource);
+		}
+	#endif
+
+		for (;;)
+		{
+			for (; *pSource != TChar(0) && nFoldedLength < nChunkLength; ++pSource)
+				arrFolded[nFoldedLength++] = FoldCharacter<LOWER_CASE>(*pSource);
+
+			if (*pSource == TChar(0))
+				break;
+
+			fnFolded(static_cast<const std::uint8_t*>(arrFolded), nFoldedLength);
+			nFoldedLength = 0U;
+		}
+
+		fnFolded(static_cast<const std::uint8_t*>(arrFolded), nFoldedLength);
+		return static_cast<std::size_t>(pSource - szSource);
+	}
+
+	/// @returns: length of the null-terminated string in characters
+	template <typename TChar>
+	inline std::size_t StringLength(const TChar* szSource) noexcept
+	{
+		if constexpr (std::is_same_v<TChar, char>)
+			return Q_HASH::SIMD::ScanString(szSource, [](const std::uint8_t*) { });
+		else
+		{
+			const TChar* szSourceEnd = szSource;
+			while (*szSourceEnd != TChar(0))
+				++szSourceEnd;
+
+			return static_cast<std::size_t>(szSourceEnd - szSource);
+		}
+	}
+
+	/// @param[in] stream incremental generation of any algorithm, that is fed with the folded string
+	/// @returns: calculated hash of the folded string
+	template <bool LOWER_CASE, typename TStream, typename TChar>
+	inline auto HashString(TStream&& stream, const TChar* szSource) noexcept
+	{
+		FoldString<LOWER_CASE>(szSource, [&stream](const std::uint8_t* pFolded, const std::size_t nFoldedLength)
+		{
+			stream.Update(pFolded, nFoldedLength);
+		});
+
+		return stream.Final();
+	}
+
+	/// @param[in] fnHash constant-evaluated buffer hash of any algorithm, callable as 'fnHash(pFolded, nFoldedLength)'
+	/// @returns: calculated at compile-time hash of the folded string
+	template <bool LOWER_CASE, typename TChar, typename THash>
+	consteval auto HashConst(const TChar* szSource, THash&& fnHash) noexcept
+	{
+		std::size_t nLength = 0U;
+		while (szSource[nLength] != TChar(0))
+			++nLength;
+
+		// transient allocation, that is released before the evaluation ends
+		std::uint8_t* pFolded = new std::uint8_t[nLength + 1U];
+		for (std::size_t i = 0U; i < nLength; ++i)
+			pFolded[i] = FoldCharacter<LOWER_CASE>(szSource[i]);
+
+		const auto hash = fnHash(static_cast<const std::uint8_t*>(pFolded), nLength);
+		delete[] pFolded;
+		return hash;
+	}
+
+	/// @param[in] fnHash one-shot buffer hash of the algorithm that takes 32-bit length, callable as 'fnHash(pSource, uLength)'
+	/// @param[in] fnMakeStream factory of the incremental generation of the same algorithm with the same key, callable as 'fnMakeStream()'
+	/// @returns: calculated hash of the buffer, where the buffers of 4 GiB and longer continue through the stream instead of their length being cut, so the algorithms that mix the length in take it modulo 2^32 as their references do
+	template <typename THash, typename TMakeStream>
+	inline auto HashLength32(const std::uint8_t* pSource, const std::size_t nLength, THash&& fnHash, TMakeStream&& fnMakeStream) noexcept
+	{
+		if (static_cast<std::uint32_t>(nLength) != nLength)
+		{
+			auto stream = fnMakeStream();
+			stream.Update(pSource, nLength);
+			return stream.Final();
+		}
+
+		return fnHash(pSource, static_cast<std::uint32_t>(nLength));
+	}
+}
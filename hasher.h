@@ -0,0 +1,110 @@
+#pragma once
+// used: [stl] size_t, byte
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] convertible_to
+#include <concepts>
+// used: [stl] span
+#include <span>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] true_type, is_convertible_v, is_integral_v, has_unique_object_representations_v
+#include <type_traits>
+
+#define Q_HASH_HASHER
+
+/*
+ * FUNCTION OBJECTS FOR THE STANDARD AND THIRD-PARTY UNORDERED CONTAINERS
+ * @note: every string-like key is hashed by its characters through the 'std::string_view', and the byte spans by their contents, so 'std::string', 'std::string_view', 'const char*' and the span over the same bytes give the same hash, and the heterogeneous lookup doesn't construct the key
+ */
+namespace Q_HASH
+{
+	/// @returns: whether the hasher marks its result as well-distributed through the 'is_avalanching' member type, either of the 'std::true_type'/'std::false_type' kind or just present
+	template <typename THasher>
+	inline constexpr bool IsAvalanching = []
+	{
+		if constexpr (requires { typename THasher::is_avalanching; })
+		{
+			if constexpr (requires { { THasher::is_avalanching::value } -> std::convertible_to<bool>; })
+				return static_cast<bool>(THasher::is_avalanching::value);
+			else
+				return true;
+		}
+		else
+			return false;
+	}();
+
+	namespace DETAIL
+	{
+		/// @returns: hash of any width narrowed to the 'std::size_t'
+		template <typename THash>
+		constexpr std::size_t FoldHash(const THash hash) noexcept
+		{
+			// 128-bit results are the pairs of the independently mixed halves, so the low one is enough
+			if constexpr (std::is_integral_v<THash>)
+				return static_cast<std::size_t>(hash);
+			else
+				return static_cast<std::size_t>(hash.ullLow);
+		}
+
+		template <bool AVALANCHING>
+		struct AvalanchingBase_t { };
+
+		template <>
+		struct AvalanchingBase_t<true>
+		{
+			// recognized by 'boost::unordered' and 'ankerl::unordered_dense', that skip their own post-mixing of the hash then
+			using is_avalanching = std::true_type;
+		};
+	}
+
+	/// hasher policy for 'std::unordered_map', 'std::unordered_set' and alike containers, also usable with the 'CFlatMap'
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM', e.g. 'Q_HASH::CHasher<Q_HASH::ALGORITHM::FNV1A_64>'
+	/// @note: the hashes narrower than 'std::size_t' are zero-extended, so their hashers never claim to avalanche, as the containers that trust it take the bucket from the high bits
+	template <typename TAlgorithm>
+	struct CHasher : DETAIL::AvalanchingBase_t<TAlgorithm::bAvalanching && sizeof(typename TAlgorithm::Hash_t) >= sizeof(std::size_t)>
+	{
+		// enables the heterogeneous lookup together with the transparent 'std::equal_to<>'
+		using is_transparent = void;
+
+		constexpr CHasher() noexcept = default;
+
+		/// @param[in] uSeed seed of the hash generation
+		explicit constexpr CHasher(const std::uint32_t uSeed) noexcept :
+			uSeed(uSeed) { }
+
+		/// @param[in] strSource string, string view or null-terminated string for which the hash will be generated
+		/// @returns: calculated hash of the string characters
+		std::size_t operator()(const std::string_view strSource) const noexcept
+		{
+			return DETAIL::FoldHash(TAlgorithm::Hash(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), uSeed));
+		}
+
+		/// @param[in] spanSource bytes for which the hash will be generated
+		/// @returns: calculated hash of the bytes, equal to the hash of the string with the same characters
+		std::size_t operator()(const std::span<const std::uint8_t> spanSource) const noexcept
+		{
+			return DETAIL::FoldHash(TAlgorithm::Hash(spanSource.data(), spanSource.size(), uSeed));
+		}
+
+		/// @param[in] spanSource bytes for which the hash will be generated
+		/// @returns: calculated hash of the bytes, equal to the hash of the string with the same characters
+		std::size_t operator()(const std::span<const std::byte> spanSource) const noexcept
+		{
+			return DETAIL::FoldHash(TAlgorithm::Hash(reinterpret_cast<const std::uint8_t*>(spanSource.data()), spanSource.size(), uSeed));
+		}
+
+		/// @param[in] key object for which the hash of its representation will be generated
+		/// @returns: calculated hash of the object bytes
+		template <typename T> requires (!std::is_convertible_v<const T&, std::string_view> && !std::is_convertible_v<const T&, std::span<const std::uint8_t>> && !std::is_convertible_v<const T&, std::span<const std::byte>>)
+		std::size_t operator()(const T& key) const noexcept
+		{
+			static_assert(std::has_unique_object_representations_v<T>, "key must be a string, bytes or have no padding bits to be hashed by bytes");
+			return DETAIL::FoldHash(TAlgorithm::Hash(reinterpret_cast<const std::uint8_t*>(&key), sizeof(T), uSeed));
+		}
+
+	private:
+		std::uint32_t uSeed = 0U;
+	};
+}
@@ -0,0 +1,559 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] memcpy
+#include <cstring>
+// used: [stl] sort, merge
+#include <algorithm>
+// used: [stl] countl_zero
+#include <bit>
+// used: [stl] back_inserter
+#include <iterator>
+// used: [stl] sqrt, llround, HUGE_VAL
+#include <cmath>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_integral_v
+#include <type_traits>
+// used: [stl] move
+#include <utility>
+// used: [stl] vector
+#include <vector>
+
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch
+#include "simd.h"
+
+#if !defined(Q_HASH_HYPERLOGLOG_NO_AVX2) && defined(Q_HASH_CPU_X86)
+#define Q_HASH_HYPERLOGLOG_AVX2
+#endif
+
+#define Q_HASH_HYPERLOGLOG
+
+/*
+ * HYPERLOGLOG++ CARDINALITY ESTIMATOR
+ * @note: the sketch starts sparse, as the sorted list of the registers of the finer 25-bit precision that were hit, and turns into the dense array of the byte registers once the list would take more memory than it, the dense sketches are merged by the vector maximum of their registers
+ * cardinality is estimated from the histogram of the register values, which is unbiased over the whole range without the empirical correction tables
+ * @credits: Stefan Heule, Marc Nunkesser, Alexander Hall - HyperLogLog in Practice; Otmar Ertl - New cardinality estimation algorithms for HyperLogLog sketches
+ */
+namespace Q_HASH
+{
+	namespace DETAIL
+	{
+		// precision of the sparse registers, the index and the value of each fit 31 bits
+		inline constexpr unsigned int nHllSparsePrecision = 25U;
+		// bits of the sparse entry that hold the register value
+		inline constexpr unsigned int nHllSparseValueBits = 6U;
+		// 'QHLL' in the little-endian order
+		inline constexpr std::uint32_t uHllMagic = 0x4C4C4851;
+		inline constexpr std::uint8_t uHllVersion = 1U;
+
+		enum EHllEncoding : std::uint8_t
+		{
+			HLL_ENCODING_SPARSE = 0U,
+			HLL_ENCODING_DENSE
+		};
+
+		/// header of the serialized sketch, followed by either the sorted sparse entries as the variable-length deltas or the dense registers packed by 6 bits
+		struct HllHeader_t
+		{
+			std::uint32_t uMagic;
+			std::uint8_t uVersion;
+			std::uint8_t uPrecision;
+			std::uint8_t uEncoding;
+			std::uint8_t uReserved;
+			// count of the sparse entries, zero for the dense sketch
+			std::uint32_t uEntryCount;
+		};
+
+		/// @returns: 64-bit hash with all bits avalanched, so the index and the run of zeros are independent
+		template <typename TAlgorithm>
+		constexpr std::uint64_t HllPrepareHash(const typename TAlgorithm::Hash_t& hash) noexcept
+		{
+			std::uint64_t ullHash;
+			if constexpr (std::is_integral_v<typename TAlgorithm::Hash_t>)
+				ullHash = static_cast<std::uint64_t>(hash);
+			else
+				ullHash = hash.ullLow;
+
+			// high bits of the multiplicative hashes, e.g. FNV1A, depend on the last bytes too weakly, and the ones of the narrower hashes are just zero, that would put every element into the first register
+			if constexpr (!TAlgorithm::bAvalanching || sizeof(typename TAlgorithm::Hash_t) < sizeof(std::uint64_t))
+			{
+				ullHash ^= ullHash >> 33U;
+				ullHash *= 0xFF51AFD7ED558CCD;
+				ullHash ^= ullHash >> 33U;
+				ullHash *= 0xC4CEB9FE1A85EC53;
+				ullHash ^= ullHash >> 33U;
+			}
+
+			return ullHash;
+		}
+
+		/// @returns: position of the first set bit of the hash after the given count of the index bits, one-based, or the count of the remaining bits plus one if none is set
+		constexpr std::uint8_t HllRank(const std::uint64_t ullHash, const unsigned int nIndexBits) noexcept
+		{
+			const std::uint64_t ullRest = ullHash << nIndexBits;
+			return static_cast<std::uint8_t>((ullRest == 0U) ? 64U - nIndexBits + 1U : static_cast<unsigned int>(std::countl_zero(ullRest)) + 1U);
+		}
+
+		/* @section: estimation */
+		inline double HllSigma(double flValue) noexcept
+		{
+			if (flValue == 1.0)
+				return HUGE_VAL;
+
+			double flMultiplier = 1.0, flSum = flValue, flPreviousSum;
+			do
+			{
+				flValue *= flValue;
+				flPreviousSum = flSum;
+				flSum += flValue * flMultiplier;
+				flMultiplier += flMultiplier;
+			} while (flSum != flPreviousSum);
+
+			return flSum;
+		}
+
+		inline double HllTau(double flValue) noexcept
+		{
+			if (flValue == 0.0 || flValue == 1.0)
+				return 0.0;
+
+			double flMultiplier = 1.0, flSum = 1.0 - flValue, flPreviousSum;
+			do
+			{
+				flValue = std::sqrt(flValue);
+				flPreviousSum = flSum;
+				flMultiplier *= 0.5;
+				flSum -= (1.0 - flValue) * (1.0 - flValue) * flMultiplier;
+			} while (flSum != flPreviousSum);
+
+			return flSum / 3.0;
+		}
+
+		/// @param[in] pHistogram count of the registers of each value in range [0, 64 - nPrecision + 1]
+		/// @returns: estimated count of the distinct hashes
+		inline std::uint64_t HllEstimate(const std::uint32_t* pHistogram, const unsigned int nPrecision) noexcept
+		{
+			const double flRegisterCount = static_cast<double>(1ULL << nPrecision);
+			const unsigned int nMaxRank = 64U - nPrecision;
+
+			double flSum = flRegisterCount * HllTau((flRegisterCount - pHistogram[nMaxRank + 1U]) / flRegisterCount);
+			for (unsigned int i = nMaxRank; i >= 1U; --i)
+				flSum = 0.5 * (flSum + pHistogram[i]);
+			flSum += flRegisterCount * HllSigma(pHistogram[0] / flRegisterCount);
+
+			// 1 / (2 * ln(2))
+			constexpr double flAlpha = 0.72134752044448170367996234050095;
+			return static_cast<std::uint64_t>(std::llround(flAlpha * flRegisterCount * flRegisterCount / flSum));
+		}
+
+		/* @section: merge */
+		inline void HllMergeScalar(std::uint8_t* pRegisters, const std::uint8_t* pOtherRegisters, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				pRegisters[i] = (pOtherRegisters[i] > pRegisters[i]) ? pOtherRegisters[i] : pRegisters[i];
+		}
+
+	#ifdef Q_HASH_HYPERLOGLOG_AVX2
+		Q_HASH_TARGET("avx2") inline void HllMergeAVX2(std::uint8_t* pRegisters, const std::uint8_t* pOtherRegisters, const std::size_t nCount) noexcept
+		{
+			std::size_t i = 0U;
+
+			// four independent vectors per iteration to keep both load ports busy
+			for (; i + 128U <= nCount; i += 128U)
+			{
+				__m256i* pDestination = reinterpret_cast<__m256i*>(pRegisters + i);
+				const __m256i* pSource = reinterpret_cast<const __m256i*>(pOtherRegisters + i);
+
+				const __m256i ymmFirst = _mm256_max_epu8(_mm256_loadu_si256(pDestination), _mm256_loadu_si256(pSource));
+				const __m256i ymmSecond = _mm256_max_epu8(_mm256_loadu_si256(pDestination + 1), _mm256_loadu_si256(pSource + 1));
+				const __m256i ymmThird = _mm256_max_epu8(_mm256_loadu_si256(pDestination + 2), _mm256_loadu_si256(pSource + 2));
+				const __m256i ymmFourth = _mm256_max_epu8(_mm256_loadu_si256(pDestination + 3), _mm256_loadu_si256(pSource + 3));
+
+				_mm256_storeu_si256(pDestination, ymmFirst);
+				_mm256_storeu_si256(pDestination + 1, ymmSecond);
+				_mm256_storeu_si256(pDestination + 2, ymmThird);
+				_mm256_storeu_si256(pDestination + 3, ymmFourth);
+			}
+
+			HllMergeScalar(pRegisters + i, pOtherRegisters + i, nCount - i);
+		}
+
+		using HllMerge_t = void(std::uint8_t*, const std::uint8_t*, std::size_t) noexcept;
+
+		inline HllMerge_t* ResolveHllMerge() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &HllMergeAVX2;
+
+			return &HllMergeScalar;
+		}
+
+		using HllMergeDispatch_t = Q_HASH::CPU::CDispatch<HllMerge_t, &ResolveHllMerge>;
+	#endif
+
+		inline void HllMerge(std::uint8_t* pRegisters, const std::uint8_t* pOtherRegisters, const std::size_t nCount) noexcept
+		{
+		#ifdef Q_HASH_HYPERLOGLOG_AVX2
+			HllMergeDispatch_t::Call(pRegisters, pOtherRegisters, nCount);
+		#else
+			HllMergeScalar(pRegisters, pOtherRegisters, nCount);
+		#endif
+		}
+	}
+
+	/// sketch of the multiset, that estimates the count of its distinct elements with about '1.04 / sqrt(2 ^ PRECISION)' relative error, e.g. 0.8% for the default precision in the 16KB of memory
+	/// @tparam TAlgorithm any of the uniform interfaces from 'Q_HASH::ALGORITHM' the elements are hashed by, e.g. 'Q_HASH::ALGORITHM::MURMUR2_64', only 64 bits of the hash are used and the non-avalanching or 32-bit ones are mixed first
+	/// @tparam PRECISION count of the hash bits that select the dense register, in range [4, 18]
+	template <typename TAlgorithm, unsigned int PRECISION = 14U>
+	class CHyperLogLog
+	{
+		static_assert(PRECISION >= 4U && PRECISION <= 18U, "HyperLogLog precision must be in range [4, 18]");
+
+		static constexpr std::size_t nRegisterCount = 1ULL << PRECISION;
+		// highest value of the dense register
+		static constexpr unsigned int nMaxRank = 64U - PRECISION + 1U;
+		// count of the sparse entries that take the same memory as the dense registers
+		static constexpr std::size_t nMaxSparseCount = nRegisterCount / sizeof(std::uint32_t);
+		// count of the unsorted entries that are gathered before they are merged into the sorted list
+		static constexpr std::size_t nMaxPendingCount = (nMaxSparseCount / 4U < 16U) ? 16U : nMaxSparseCount / 4U;
+
+	public:
+		using Hash_t = typename TAlgorithm::Hash_t;
+
+		/* @section: get */
+		/// @returns: true if the sketch holds the sparse list of the hit registers, false if it holds all registers
+		[[nodiscard]] bool IsSparse() const noexcept
+		{
+			return vecRegisters.empty();
+		}
+
+		/// @returns: estimated count of the distinct elements added to the sketch and all sketches merged into it
+		[[nodiscard]] std::uint64_t Estimate() const
+		{
+			if (IsSparse())
+			{
+				// sparse entries are the registers of the finer precision, the rest of them are zero
+				std::vector<std::uint32_t> vecMerged;
+				const std::vector<std::uint32_t>& vecEntries = GetSparseEntries(vecMerged);
+
+				std::uint32_t arrHistogram[64U - DETAIL::nHllSparsePrecision + 2U] = { };
+				arrHistogram[0] = static_cast<std::uint32_t>((1ULL << DETAIL::nHllSparsePrecision) - vecEntries.size());
+				for (const std::uint32_t uEntry : vecEntries)
+					++arrHistogram[uEntry & ((1U << DETAIL::nHllSparseValueBits) - 1U)];
+
+				return DETAIL::HllEstimate(arrHistogram, DETAIL::nHllSparsePrecision);
+			}
+
+			std::uint32_t arrHistogram[nMaxRank + 1U] = { };
+			for (const std::uint8_t uRegister : vecRegisters)
+				++arrHistogram[uRegister];
+
+			return DETAIL::HllEstimate(arrHistogram, PRECISION);
+		}
+
+		/* @section: set */
+		void Add(const std::uint8_t* pSource, const std::size_t nLength)
+		{
+			AddHash(TAlgorithm::Hash(pSource, nLength));
+		}
+
+		void Add(const std::string_view strElement)
+		{
+			AddHash(TAlgorithm::Hash(reinterpret_cast<const std::uint8_t*>(strElement.data()), strElement.size()));
+		}
+
+		/// @param[in] hash precomputed hash of the element by the 'TAlgorithm' with the zero seed
+		void AddHash(const Hash_t& hash)
+		{
+			const std::uint64_t ullHash = DETAIL::HllPrepareHash<TAlgorithm>(hash);
+
+			if (!IsSparse())
+			{
+				std::uint8_t& uRegister = vecRegisters[static_cast<std::size_t>(ullHash >> (64U - PRECISION))];
+				const std::uint8_t uRank = DETAIL::HllRank(ullHash, PRECISION);
+				uRegister = (uRank > uRegister) ? uRank : uRegister;
+				return;
+			}
+
+			vecPending.push_back((static_cast<std::uint32_t>(ullHash >> (64U - DETAIL::nHllSparsePrecision)) << DETAIL::nHllSparseValueBits) | DETAIL::HllRank(ullHash, DETAIL::nHllSparsePrecision));
+
+			if (vecPending.size() >= nMaxPendingCount)
+			{
+				FlushPending();
+
+				if (vecSparse.size() > nMaxSparseCount)
+					ConvertToDense();
+			}
+		}
+
+		/// merge the elements of the other sketch into this one, so the estimate is of the union of both
+		void Merge(const CHyperLogLog& other)
+		{
+			if (other.IsSparse())
+			{
+				std::vector<std::uint32_t> vecOtherMerged;
+				const std::vector<std::uint32_t>& vecOtherEntries = other.GetSparseEntries(vecOtherMerged);
+
+				if (IsSparse())
+				{
+					vecPending.insert(vecPending.end(), vecOtherEntries.begin(), vecOtherEntries.end());
+					FlushPending();
+
+					if (vecSparse.size() > nMaxSparseCount)
+						ConvertToDense();
+				}
+				else
+				{
+					for (const std::uint32_t uEntry : vecOtherEntries)
+						AddSparseEntry(uEntry);
+				}
+
+				return;
+			}
+
+			if (IsSparse())
+				ConvertToDense();
+
+			DETAIL::HllMerge(vecRegisters.data(), other.vecRegisters.data(), nRegisterCount);
+		}
+
+		/// remove all elements
+		void Clear() noexcept
+		{
+			vecRegisters.clear();
+			vecRegisters.shrink_to_fit();
+			vecSparse.clear();
+			vecPending.clear();
+		}
+
+		/* @section: serialization */
+		/// @returns: size of the serialized sketch in bytes
+		[[nodiscard]] std::size_t SerializedSize() const
+		{
+			if (!IsSparse())
+				return sizeof(DETAIL::HllHeader_t) + nRegisterCount / 4U * 3U;
+
+			std::vector<std::uint32_t> vecMerged;
+			const std::vector<std::uint32_t>& vecEntries = GetSparseEntries(vecMerged);
+
+			std::size_t nSize = sizeof(DETAIL::HllHeader_t);
+			std::uint32_t uPrevious = 0U;
+			for (const std::uint32_t uEntry : vecEntries)
+			{
+				for (std::uint32_t uDelta = uEntry - uPrevious; uDelta >= 0x80; uDelta >>= 7U)
+					++nSize;
+
+				++nSize;
+				uPrevious = uEntry;
+			}
+
+			return nSize;
+		}
+
+		/// write the sketch in the compact form, the header fields are stored in the native byte order
+		/// @param[out] pDestination buffer of at least 'SerializedSize()' bytes
+		/// @returns: count of the written bytes
+		std::size_t Serialize(void* pDestination) const
+		{
+			std::vector<std::uint32_t> vecMerged;
+			const std::vector<std::uint32_t>& vecEntries = IsSparse() ? GetSparseEntries(vecMerged) : vecSparse;
+
+			DETAIL::HllHeader_t header = { };
+			header.uMagic = DETAIL::uHllMagic;
+			header.uVersion = DETAIL::uHllVersion;
+			header.uPrecision = static_cast<std::uint8_t>(PRECISION);
+			header.uEncoding = IsSparse() ? DETAIL::HLL_ENCODING_SPARSE : DETAIL::HLL_ENCODING_DENSE;
+			header.uEntryCount = static_cast<std::uint32_t>(vecEntries.size());
+			std::memcpy(pDestination, &header, sizeof(DETAIL::HllHeader_t));
+
+			std::uint8_t* pData = static_cast<std::uint8_t*>(pDestination) + sizeof(DETAIL::HllHeader_t);
+
+			if (IsSparse())
+			{
+				// sorted entries are stored as the 7-bit groups of their deltas, the high bit marks that more groups follow
+				std::uint32_t uPrevious = 0U;
+				for (const std::uint32_t uEntry : vecEntries)
+				{
+					std::uint32_t uDelta = uEntry - uPrevious;
+					for (; uDelta >= 0x80; uDelta >>= 7U)
+						*pData++ = static_cast<std::uint8_t>(uDelta | 0x80);
+
+					*pData++ = static_cast<std::uint8_t>(uDelta);
+					uPrevious = uEntry;
+				}
+			}
+			else
+			{
+				// each four 6-bit registers are packed into three bytes
+				for (std::size_t i = 0U; i < nRegisterCount; i += 4U, pData += 3U)
+				{
+					const std::uint32_t uPacked = vecRegisters[i] | (vecRegisters[i + 1U] << 6U) | (vecRegisters[i + 2U] << 12U) | (vecRegisters[i + 3U] << 18U);
+					pData[0] = static_cast<std::uint8_t>(uPacked);
+					pData[1] = static_cast<std::uint8_t>(uPacked >> 8U);
+					pData[2] = static_cast<std::uint8_t>(uPacked >> 16U);
+				}
+			}
+
+			return static_cast<std::size_t>(pData - static_cast<std::uint8_t*>(pDestination));
+		}
+
+		/// replace the sketch with the serialized one
+		/// @param[in] pData serialized sketch
+		/// @param[in] nSize size of the data in bytes
+		/// @returns: true if the sketch has been loaded, false if the data isn't the sketch of the same precision or is damaged, then this sketch is left unchanged
+		bool Deserialize(const void* pData, const std::size_t nSize)
+		{
+			DETAIL::HllHeader_t header;
+			if (pData == nullptr || nSize < sizeof(DETAIL::HllHeader_t))
+				return false;
+
+			std::memcpy(&header, pData, sizeof(DETAIL::HllHeader_t));
+			if (header.uMagic != DETAIL::uHllMagic || header.uVersion != DETAIL::uHllVersion || header.uPrecision != PRECISION)
+				return false;
+
+			const std::uint8_t* pSource = static_cast<const std::uint8_t*>(pData) + sizeof(DETAIL::HllHeader_t);
+			const std::uint8_t* pSourceEnd = static_cast<const std::uint8_t*>(pData) + nSize;
+
+			if (header.uEncoding == DETAIL::HLL_ENCODING_DENSE)
+			{
+				if (static_cast<std::size_t>(pSourceEnd - pSource) < nRegisterCount / 4U * 3U)
+					return false;
+
+				std::vector<std::uint8_t> vecNewRegisters(nRegisterCount);
+				for (std::size_t i = 0U; i < nRegisterCount; i += 4U, pSource += 3U)
+				{
+					const std::uint32_t uPacked = pSource[0] | (pSource[1] << 8U) | (pSource[2] << 16U);
+					for (std::size_t j = 0U; j < 4U; ++j)
+					{
+						vecNewRegisters[i + j] = static_cast<std::uint8_t>((uPacked >> (j * 6U)) & 0x3F);
+
+						if (vecNewRegisters[i + j] > nMaxRank)
+							return false;
+					}
+				}
+
+				Clear();
+				vecRegisters = std::move(vecNewRegisters);
+				return true;
+			}
+
+			if (header.uEncoding != DETAIL::HLL_ENCODING_SPARSE || header.uEntryCount > nMaxSparseCount + nMaxPendingCount)
+				return false;
+
+			std::vector<std::uint32_t> vecNewSparse;
+			vecNewSparse.reserve(header.uEntryCount);
+
+			std::uint64_t ullEntry = 0U;
+			for (std::uint32_t i = 0U; i < header.uEntryCount; ++i)
+			{
+				std::uint32_t uDelta = 0U;
+				for (unsigned int nShift = 0U;; nShift += 7U)
+				{
+					if (pSource == pSourceEnd || nShift > 28U)
+						return false;
+
+					const std::uint8_t uByte = *pSource++;
+					uDelta |= static_cast<std::uint32_t>(uByte & 0x7F) << nShift;
+
+					if ((uByte & 0x80) == 0U)
+						break;
+				}
+
+				// entries must be strictly increasing and hold the value that the hash of the finer precision can have
+				ullEntry += uDelta;
+				const std::uint64_t ullValue = ullEntry & ((1U << DETAIL::nHllSparseValueBits) - 1U);
+				if ((i != 0U && uDelta == 0U) || (ullEntry >> DETAIL::nHllSparseValueBits) >= (1ULL << DETAIL::nHllSparsePrecision) || ullValue == 0U || ullValue > 64U - DETAIL::nHllSparsePrecision + 1U)
+					return false;
+
+				vecNewSparse.push_back(static_cast<std::uint32_t>(ullEntry));
+			}
+
+			Clear();
+			vecSparse = std::move(vecNewSparse);
+			return true;
+		}
+
+	private:
+		/// @param[in] vecSorted sorted entries without the duplicate registers
+		/// @param[in] vecUnsorted entries in any order
+		/// @returns: sorted entries of both, keeping the highest value of each register
+		static std::vector<std::uint32_t> MergeSparse(const std::vector<std::uint32_t>& vecSorted, std::vector<std::uint32_t> vecUnsorted)
+		{
+			std::sort(vecUnsorted.begin(), vecUnsorted.end());
+
+			std::vector<std::uint32_t> vecMerged;
+			vecMerged.reserve(vecSorted.size() + vecUnsorted.size());
+			std::merge(vecSorted.begin(), vecSorted.end(), vecUnsorted.begin(), vecUnsorted.end(), std::back_inserter(vecMerged));
+
+			// entries of the same register are adjacent and ordered by their value, so the last one is kept
+			std::size_t nCount = 0U;
+			for (std::size_t i = 0U; i < vecMerged.size(); ++i)
+			{
+				if (i + 1U < vecMerged.size() && (vecMerged[i] >> DETAIL::nHllSparseValueBits) == (vecMerged[i + 1U] >> DETAIL::nHllSparseValueBits))
+					continue;
+
+				vecMerged[nCount++] = vecMerged[i];
+			}
+
+			vecMerged.resize(nCount);
+			return vecMerged;
+		}
+
+		/// merge the unsorted entries into the sorted list
+		void FlushPending()
+		{
+			if (vecPending.empty())
+				return;
+
+			vecSparse = MergeSparse(vecSparse, std::move(vecPending));
+			vecPending.clear();
+		}
+
+		/// @param[out] vecMerged storage of the merged entries, used only when there are pending ones
+		/// @returns: sorted entries of the sparse sketch including the pending ones, the sketch itself is left unchanged so it can be queried concurrently
+		const std::vector<std::uint32_t>& GetSparseEntries(std::vector<std::uint32_t>& vecMerged) const
+		{
+			if (vecPending.empty())
+				return vecSparse;
+
+			vecMerged = MergeSparse(vecSparse, vecPending);
+			return vecMerged;
+		}
+
+		/// update the dense register with the sparse entry of the finer precision
+		void AddSparseEntry(const std::uint32_t uEntry) noexcept
+		{
+			constexpr unsigned int nExtraBits = DETAIL::nHllSparsePrecision - PRECISION;
+			const std::uint32_t uSparseIndex = uEntry >> DETAIL::nHllSparseValueBits;
+			const std::uint32_t uExtraIndex = uSparseIndex & ((1U << nExtraBits) - 1U);
+
+			// the run of zeros either ends within the index bits that are finer than the dense ones, or continues into the sparse value
+			const std::uint8_t uRank = static_cast<std::uint8_t>((uExtraIndex != 0U) ? static_cast<unsigned int>(std::countl_zero(uExtraIndex)) - (32U - nExtraBits) + 1U : nExtraBits + (uEntry & ((1U << DETAIL::nHllSparseValueBits) - 1U)));
+
+			std::uint8_t& uRegister = vecRegisters[uSparseIndex >> nExtraBits];
+			uRegister = (uRank > uRegister) ? uRank : uRegister;
+		}
+
+		void ConvertToDense()
+		{
+			FlushPending();
+			vecRegisters.assign(nRegisterCount, 0U);
+
+			for (const std::uint32_t uEntry : vecSparse)
+				AddSparseEntry(uEntry);
+
+			vecSparse.clear();
+			vecSparse.shrink_to_fit();
+		}
+
+		// dense registers, empty while the sketch is sparse
+		std::vector<std::uint8_t> vecRegisters = { };
+		// sorted entries of the sparse sketch, each holds the register index of the finer precision and its value
+		std::vector<std::uint32_t> vecSparse = { };
+		// unsorted entries that are merged into the sorted ones once there are enough of them, or the sketch is merged or turns dense
+		std::vector<std::uint32_t> vecPending = { };
+	};
+}
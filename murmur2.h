@@ -1,17 +1,25 @@
 #pragma once
+// used: [stl] size_t
+#include <cstddef>
 // used: [stl] uint32_t
 #include <cstdint>
 // used: [stl] endian
 #include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
 
 #if Q_HAS_INCLUDE("q-tee/crt/crt.h")
 // used: stringlength
 #include <q-tee/crt/crt.h>
-#else
-// used: [crt] strlen
-#include <cstring>
 #endif
 
+// used: scanstring
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst, stringlength, hashlength32
+#include "fold.h"
+
 #define Q_HASH_MURMUR2
 
 #ifndef Q_HASH_MURMUR2_MODULO
@@ -28,70 +36,86 @@ namespace MURMUR2
 {
 	namespace DETAIL
 	{
-		consteval std::uint32_t XorShr(const std::uint32_t uValue, const std::uint32_t uShift)
+		/// @returns: endian-independent load of 4 bytes
+		template <typename T>
+		constexpr std::uint32_t LoadBlock(const T* pSource) noexcept
 		{
-			return uValue ^ (uValue >> uShift);
-		}
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint32_t*>(pSource);
+			}
 
-		consteval MurMur2_t ProcessBlock(const char* szSource, const std::uint32_t nLength, const MurMur2_t uHash)
-		{
-			return
-				nLength >= 4U ? ProcessBlock(szSource + 4U, nLength - 4U, (uHash * Q_HASH_MURMUR2_MODULO) ^ (XorShr(static_cast<std::uint32_t>(szSource[0] | (szSource[1] << 8U) | (szSource[2] << 16U) | (szSource[3] << 24U)) * Q_HASH_MURMUR2_MODULO, 24U) * Q_HASH_MURMUR2_MODULO)) :
-				nLength == 3U ? ProcessBlock(szSource, nLength - 1U, uHash ^ (szSource[2] << 16U)) :
-				nLength == 2U ? ProcessBlock(szSource, nLength - 1U, uHash ^ (szSource[1] << 8U)) :
-				nLength == 1U ? ProcessBlock(szSource, nLength - 1U, (uHash ^ szSource[0]) * Q_HASH_MURMUR2_MODULO) :
-				XorShr(XorShr(uHash, 13U) * Q_HASH_MURMUR2_MODULO, 15U);
+			return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[0])) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[1])) << 8U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[2])) << 16U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[3])) << 24U));
 		}
-	}
-
-	/// @param[in] pSource buffer for which the hash will be generated
-	/// @param[in] nLength length of the source buffer in bytes
-	/// @param[in] uSeed initial key of the hash generation
-	/// @returns: calculated hash of the given buffer
-	inline MurMur2_t Hash(const std::uint8_t* pSource, std::uint32_t nLength, const std::uint32_t uSeed = 0U) noexcept
-	{
-		MurMur2_t uHash = uSeed ^ nLength;
 
-		while (nLength >= sizeof(std::uint32_t))
+		/// @param[in] pSource buffer of which only the whole blocks are processed
+		/// @returns: hash state after processing all the whole 4-byte blocks of the buffer
+		template <typename T>
+		constexpr MurMur2_t ProcessBody(const T* pSource, std::size_t nLength, MurMur2_t uHash) noexcept
 		{
-			// endian-independent load of 4 bytes
-			std::uint32_t uBlock;
-			if constexpr (std::endian::native == std::endian::little)
-				uBlock = *reinterpret_cast<const std::uint32_t*>(pSource);
-			else
-				uBlock = (static_cast<std::uint32_t>(pSource[0]) | (static_cast<std::uint32_t>(pSource[1]) << 8U) | (static_cast<std::uint32_t>(pSource[2]) << 16U) | (static_cast<std::uint32_t>(pSource[3]) << 24U));
+			while (nLength >= sizeof(std::uint32_t))
+			{
+				std::uint32_t uBlock = LoadBlock(pSource);
+				uBlock *= Q_HASH_MURMUR2_MODULO;
+				uBlock ^= uBlock >> 24U;
+				uBlock *= Q_HASH_MURMUR2_MODULO;
 
-			uBlock *= Q_HASH_MURMUR2_MODULO;
-			uBlock ^= uBlock >> 24U;
-			uBlock *= Q_HASH_MURMUR2_MODULO;
+				uHash *= Q_HASH_MURMUR2_MODULO;
+				uHash ^= uBlock;
 
-			uHash *= Q_HASH_MURMUR2_MODULO;
-			uHash ^= uBlock;
+				pSource += sizeof(std::uint32_t);
+				nLength -= sizeof(std::uint32_t);
+			}
 
-			pSource += sizeof(std::uint32_t);
-			nLength -= sizeof(std::uint32_t);
+			return uHash;
 		}
 
-		switch (nLength)
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than block size
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr MurMur2_t ProcessTail(const T* pSource, const std::size_t nRemainingLength, MurMur2_t uHash) noexcept
 		{
-		case 3U:
-			uHash ^= pSource[2] << 16U;
-			[[fallthrough]];
-		case 2U:
-			uHash ^= pSource[1] << 8U;
-			[[fallthrough]];
-		case 1U:
-			uHash ^= pSource[0];
+			switch (nRemainingLength)
+			{
+			case 3U:
+				uHash ^= static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[2])) << 16U;
+				[[fallthrough]];
+			case 2U:
+				uHash ^= static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[1])) << 8U;
+				[[fallthrough]];
+			case 1U:
+				uHash ^= static_cast<std::uint8_t>(pSource[0]);
+				uHash *= Q_HASH_MURMUR2_MODULO;
+				break;
+			default:
+				break;
+			}
+
+			uHash ^= uHash >> 13U;
 			uHash *= Q_HASH_MURMUR2_MODULO;
-			break;
-		default:
-			break;
+			uHash ^= uHash >> 15U;
+			return uHash;
 		}
 
-		uHash ^= uHash >> 13U;
-		uHash *= Q_HASH_MURMUR2_MODULO;
-		uHash ^= uHash >> 15U;
-		return uHash;
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr MurMur2_t HashBytes(const T* pSource, const std::uint32_t nLength, const std::uint32_t uSeed) noexcept
+		{
+			const MurMur2_t uHash = ProcessBody(pSource, nLength, uSeed ^ nLength);
+			return ProcessTail(pSource + (nLength & ~3U), nLength & 3U, uHash);
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr MurMur2_t Hash(const std::uint8_t* pSource, const std::uint32_t nLength, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, uSeed);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
@@ -99,12 +123,17 @@ namespace MURMUR2
 	/// @returns: calculated hash of the given string
 	inline MurMur2_t Hash(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
 	{
-#ifdef Q_CRT
-		const std::size_t nLength = CRT::StringLength(szSource);
-#else
-		const std::size_t nLength = ::strlen(szSource);
-#endif
-		return Hash(reinterpret_cast<const std::uint8_t*>(szSource), static_cast<std::uint32_t>(nLength), uSeed);
+		// length is mixed into the initial state, so the blocks can't be mixed before the terminator is found, but the vectorized search leaves them in the cache for the mixing
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [](const std::uint8_t*) { });
+		return DETAIL::HashBytes(szSource, static_cast<std::uint32_t>(nLength), uSeed);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr MurMur2_t Hash(const std::string_view strSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(strSource.data(), static_cast<std::uint32_t>(strSource.size()), uSeed);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
@@ -121,6 +150,151 @@ namespace MURMUR2
 
 		const std::size_t nLength = szSourceEnd - szSource;
 #endif
-		return DETAIL::ProcessBlock(szSource, static_cast<std::uint32_t>(nLength), uSeed ^ static_cast<std::uint32_t>(nLength));
+		return DETAIL::HashBytes(szSource, static_cast<std::uint32_t>(nLength), uSeed);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	/// @note: total length of the data must be known beforehand, as it is mixed into the initial state
+	class CStream
+	{
+	public:
+		/// @param[in] nTotalLength total length of all the buffers that will be appended, in bytes
+		/// @param[in] uSeed initial key of the hash generation
+		explicit CStream(const std::uint32_t nTotalLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			Init(nTotalLength, uSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] nTotalLength total length of all the buffers that will be appended, in bytes
+		/// @param[in] uSeed initial key of the hash generation
+		void Init(const std::uint32_t nTotalLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			uHash = uSeed ^ nTotalLength;
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			// complete the block that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				uHash = DETAIL::ProcessBody(arrTail, sizeof(arrTail), uHash);
+				nTailLength = 0U;
+			}
+
+			uHash = DETAIL::ProcessBody(pSource, nLength, uHash);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(3U)); nTailLength < (nLength & 3U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] MurMur2_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, uHash);
+		}
+
+	private:
+		MurMur2_t uHash;
+		std::uint8_t arrTail[sizeof(std::uint32_t)];
+		std::size_t nTailLength;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline MurMur2_t Hash(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(static_cast<std::uint32_t>(Q_HASH::FOLD::StringLength(szSource)), uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline MurMur2_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(static_cast<std::uint32_t>(Q_HASH::FOLD::StringLength(szSource)), uSeed), szSource);
 	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval MurMur2_t HashConst(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval MurMur2_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uSeed); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct MURMUR2
+	{
+		using Hash_t = MurMur2_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return Q_HASH::FOLD::HashLength32(pSource, nLength, [uSeed](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return ::MURMUR2::Hash(pBuffer, uLength, uSeed); }, [nLength, uSeed] { return ::MURMUR2::CStream(static_cast<std::uint32_t>(nLength), uSeed); });
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR2::HashConst(szSource, uSeed);
+		}
+	};
 }
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_murmur2'
+	consteval MurMur2_t operator""_murmur2(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return MURMUR2::DETAIL::HashBytes(szSource, static_cast<std::uint32_t>(nLength), 0U);
+	}
+}
+#endif
@@ -1,15 +1,30 @@
 #pragma once
+// used: [stl] size_t
+#include <cstddef>
 // used: [stl] uint64_t
 #include <cstdint>
 // used: [stl] endian
 #include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
 
 #if Q_HAS_INCLUDE("q-tee/crt/crt.h")
 // used: stringlength
 #include <q-tee/crt/crt.h>
-#else
-// used: [crt] strlen
-#include <cstring>
+#endif
+
+// used: Q_HASH_CPU_X64, Q_HASH_TARGET, hasfeatures, cdispatch, scanstring, transpose, loadblocks64, loadtail
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst, stringlength
+#include "fold.h"
+
+#ifndef Q_HASH_MURMUR2_64_NO_AVX512
+// the lengths of the batch are loaded as the vector of 64-bit integers, that 'std::size_t' is on x64 only
+#ifdef Q_HASH_CPU_X64
+#define Q_HASH_MURMUR2_64_AVX512
+#endif
 #endif
 
 #define Q_HASH_MURMUR2_64
@@ -28,86 +43,183 @@ namespace MURMUR2_64
 {
 	namespace DETAIL
 	{
-		consteval std::uint64_t XorShr(const std::uint64_t ullValue, const std::uint64_t ullShift)
+		/// @returns: endian-independent load of 8 bytes
+		template <typename T>
+		constexpr std::uint64_t LoadBlock(const T* pSource) noexcept
 		{
-			return ullValue ^ (ullValue >> ullShift);
-		}
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint64_t*>(pSource);
+			}
 
-		consteval MurMur264_t ProcessBlock(const char* szSource, const std::size_t nLength, const MurMur264_t ullHash)
-		{
-			return
-				nLength >= 8U ? ProcessBlock(szSource + 8U, nLength - 8U, (ullHash ^ XorShr((static_cast<std::uint64_t>(szSource[0]) | (static_cast<std::uint64_t>(szSource[1]) << 8ULL) | (static_cast<std::uint64_t>(szSource[2]) << 16ULL) | (static_cast<std::uint64_t>(szSource[3]) << 24ULL) | (static_cast<std::uint64_t>(szSource[4]) << 32ULL) | (static_cast<std::uint64_t>(szSource[5]) << 40ULL) | (static_cast<std::uint64_t>(szSource[6]) << 48ULL) | (static_cast<std::uint64_t>(szSource[7]) << 56ULL)) * Q_HASH_MURMUR2_64_MODULO, 47ULL) * Q_HASH_MURMUR2_64_MODULO) * Q_HASH_MURMUR2_64_MODULO) :
-				nLength == 7U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[6]) << 48ULL)) :
-				nLength == 6U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[5]) << 40ULL)) :
-				nLength == 5U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[4]) << 32ULL)) :
-				nLength == 4U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[3]) << 24ULL)) :
-				nLength == 3U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[2]) << 16ULL)) :
-				nLength == 2U ? ProcessBlock(szSource, nLength - 1U, ullHash ^ (static_cast<std::uint64_t>(szSource[1]) << 8ULL)) :
-				nLength == 1U ? ProcessBlock(szSource, nLength - 1U, (ullHash ^ static_cast<std::uint64_t>(szSource[0])) * Q_HASH_MURMUR2_64_MODULO) :
-				XorShr(XorShr(ullHash, 47ULL) * Q_HASH_MURMUR2_64_MODULO, 47ULL);
-		}
-	}
+			std::uint64_t ullBlock = 0U;
+			for (std::size_t i = 0U; i < sizeof(std::uint64_t); ++i)
+				ullBlock |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
 
-	/// @param[in] pSource buffer for which the hash will be generated
-	/// @param[in] nLength length of the source buffer in bytes
-	/// @param[in] ullSeed initial key of the hash generation
-	/// @returns: calculated hash of the given buffer
-	inline MurMur264_t Hash(const std::uint8_t* pSource, std::size_t nLength, const std::uint64_t ullSeed = 0ULL) noexcept
-	{
-		MurMur264_t uHash = ullSeed ^ (nLength * Q_HASH_MURMUR2_64_MODULO);
+			return ullBlock;
+		}
 
-		while (nLength >= sizeof(std::uint64_t))
+		/// @returns: hash state after mixing the given block into it
+		constexpr MurMur264_t MixBlock(MurMur264_t uHash, std::uint64_t ullBlock) noexcept
 		{
-			// endian-independent load of 8 bytes
-			std::uint64_t ullBlock;
-			if constexpr (std::endian::native == std::endian::little)
-				ullBlock = *reinterpret_cast<const std::uint64_t*>(pSource);
-			else
-				ullBlock = (static_cast<std::uint64_t>(pSource[0]) | (static_cast<std::uint64_t>(pSource[1]) << 8ULL) | (static_cast<std::uint64_t>(pSource[2]) << 16ULL) | (static_cast<std::uint64_t>(pSource[3]) << 24ULL) | (static_cast<std::uint64_t>(pSource[4]) << 32ULL) | (static_cast<std::uint64_t>(pSource[5]) << 40ULL) | (static_cast<std::uint64_t>(pSource[6]) << 48ULL) | (static_cast<std::uint64_t>(pSource[7]) << 56ULL));
-
 			ullBlock *= Q_HASH_MURMUR2_64_MODULO;
 			ullBlock ^= ullBlock >> 47U;
 			ullBlock *= Q_HASH_MURMUR2_64_MODULO;
 
 			uHash ^= ullBlock;
-			uHash *= Q_HASH_MURMUR2_64_MODULO;
+			return uHash * Q_HASH_MURMUR2_64_MODULO;
+		}
 
-			pSource += sizeof(std::uint64_t);
-			nLength -= sizeof(std::uint64_t);
-		}
-
-		switch (nLength)
-		{
-		case 7U:
-			uHash ^= static_cast<std::uint64_t>(pSource[6]) << 48U;
-			[[fallthrough]];
-		case 6U:
-			uHash ^= static_cast<std::uint64_t>(pSource[5]) << 40U;
-			[[fallthrough]];
-		case 5U:
-			uHash ^= static_cast<std::uint64_t>(pSource[4]) << 32U;
-			[[fallthrough]];
-		case 4U:
-			uHash ^= static_cast<std::uint64_t>(pSource[3]) << 24U;
-			[[fallthrough]];
-		case 3U:
-			uHash ^= static_cast<std::uint64_t>(pSource[2]) << 16U;
-			[[fallthrough]];
-		case 2U:
-			uHash ^= static_cast<std::uint64_t>(pSource[1]) << 8U;
-			[[fallthrough]];
-		case 1U:
-			uHash ^= static_cast<std::uint64_t>(pSource[0]);
+		/// @param[in] pSource buffer of which only the whole blocks are processed
+		/// @returns: hash state after processing all the whole 8-byte blocks of the buffer
+		template <typename T>
+		constexpr MurMur264_t ProcessBody(const T* pSource, std::size_t nLength, MurMur264_t uHash) noexcept
+		{
+			for (; nLength >= sizeof(std::uint64_t); nLength -= sizeof(std::uint64_t), pSource += sizeof(std::uint64_t))
+				uHash = MixBlock(uHash, LoadBlock(pSource));
+
+			return uHash;
+		}
+
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than block size
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr MurMur264_t ProcessTail(const T* pSource, const std::size_t nRemainingLength, MurMur264_t uHash) noexcept
+		{
+			switch (nRemainingLength)
+			{
+			case 7U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[6])) << 48U;
+				[[fallthrough]];
+			case 6U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[5])) << 40U;
+				[[fallthrough]];
+			case 5U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[4])) << 32U;
+				[[fallthrough]];
+			case 4U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[3])) << 24U;
+				[[fallthrough]];
+			case 3U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[2])) << 16U;
+				[[fallthrough]];
+			case 2U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[1])) << 8U;
+				[[fallthrough]];
+			case 1U:
+				uHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[0]));
+				uHash *= Q_HASH_MURMUR2_64_MODULO;
+				break;
+			default:
+				break;
+			}
+
+			uHash ^= uHash >> 47U;
 			uHash *= Q_HASH_MURMUR2_64_MODULO;
-			break;
-		default:
-			break;
+			uHash ^= uHash >> 47U;
+			return uHash;
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr MurMur264_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			const MurMur264_t uHash = ProcessBody(pSource, nLength, ullSeed ^ (nLength * Q_HASH_MURMUR2_64_MODULO));
+			return ProcessTail(pSource + (nLength & ~static_cast<std::size_t>(7U)), nLength & 7U, uHash);
 		}
 
-		uHash ^= uHash >> 47U;
-		uHash *= Q_HASH_MURMUR2_64_MODULO;
-		uHash ^= uHash >> 47U;
-		return uHash;
+	#ifdef Q_HASH_MURMUR2_64_AVX512
+		// count of the vector lane groups processed at once, so their multiplication latencies overlap
+		inline constexpr std::size_t nBatchGroups = 4U;
+		// count of the buffers processed at once by the vectorized batch
+		inline constexpr std::size_t nBatchLanes = nBatchGroups * 8U;
+
+		/// generate hashes of the lanes with the each hash chain in the separate vector lane, where lanes that have run out of blocks are masked out
+		Q_HASH_TARGET("avx512f,avx512dq") inline void HashLanesAVX512(const std::uint8_t* const* ppSources, const std::size_t* pLengths, MurMur264_t* pResults, const std::uint64_t ullSeed) noexcept
+		{
+			std::uint64_t arrTails[nBatchLanes];
+			std::size_t nMaxBodyLength = 0U;
+
+			for (std::size_t nLane = 0U; nLane < nBatchLanes; ++nLane)
+			{
+				const std::size_t nLength = pLengths[nLane];
+				arrTails[nLane] = Q_HASH::SIMD::LoadTail<std::uint64_t>(ppSources[nLane], nLength);
+
+				const std::size_t nBodyLength = nLength & ~static_cast<std::size_t>(7U);
+				nMaxBodyLength = (nBodyLength > nMaxBodyLength) ? nBodyLength : nMaxBodyLength;
+			}
+
+			// zero-masked shifts with all lanes selected, the unmasked ones of GCC 12 are reported as reading the uninitialized vector
+			constexpr __mmask8 kAll = 0xFF;
+			const __m512i zmmModulo = _mm512_set1_epi64(static_cast<long long>(Q_HASH_MURMUR2_64_MODULO));
+			__m512i arrHashes[nBatchGroups];
+			for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+				arrHashes[nGroup] = _mm512_xor_si512(_mm512_set1_epi64(static_cast<long long>(ullSeed)), _mm512_mullo_epi64(_mm512_loadu_si512(pLengths + nGroup * 8U), zmmModulo));
+
+			// process 8 blocks of each lane per iteration
+			for (std::size_t nOffset = 0U; nOffset < nMaxBodyLength; nOffset += sizeof(__m512i))
+			{
+				// skip the blocks that are past the body of the every lane
+				const std::size_t nBlocks = ((nMaxBodyLength - nOffset) >> 3U) < 8U ? (nMaxBodyLength - nOffset) >> 3U : 8U;
+
+				// groups are independent, so the out-of-order execution overlaps their chains
+				for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+				{
+					const std::size_t nFirstLane = nGroup * 8U;
+
+					__m512i arrRows[8];
+					for (std::size_t nRow = 0U; nRow < 8U; ++nRow)
+					{
+						const std::size_t nLength = pLengths[nFirstLane + nRow];
+						const std::size_t nRemainingBlocks = (nLength > nOffset) ? (nLength - nOffset) >> 3U : 0U;
+						arrRows[nRow] = Q_HASH::SIMD::LoadBlocks64(ppSources[nFirstLane + nRow] + (nRemainingBlocks != 0U ? nOffset : 0U), nRemainingBlocks > 8U ? 8 : static_cast<int>(nRemainingBlocks));
+					}
+
+					Q_HASH::SIMD::Transpose(arrRows);
+
+					const __m512i zmmBodyBlocks = _mm512_maskz_srli_epi64(kAll, _mm512_loadu_si512(pLengths + nFirstLane), 3);
+					for (std::size_t nBlock = 0U; nBlock < nBlocks; ++nBlock)
+					{
+						// lanes that still have a whole block at this offset
+						const __mmask8 kActive = _mm512_cmpgt_epu64_mask(zmmBodyBlocks, _mm512_set1_epi64(static_cast<long long>((nOffset >> 3U) + nBlock)));
+
+						__m512i zmmBlock = _mm512_mullo_epi64(arrRows[nBlock], zmmModulo);
+						zmmBlock = _mm512_xor_si512(zmmBlock, _mm512_maskz_srli_epi64(kAll, zmmBlock, 47));
+						zmmBlock = _mm512_mullo_epi64(zmmBlock, zmmModulo);
+
+						arrHashes[nGroup] = _mm512_mask_mullo_epi64(arrHashes[nGroup], kActive, _mm512_xor_si512(arrHashes[nGroup], zmmBlock), zmmModulo);
+					}
+				}
+			}
+
+			for (std::size_t nGroup = 0U; nGroup < nBatchGroups; ++nGroup)
+			{
+				__m512i zmmHash = arrHashes[nGroup];
+
+				// process the remaining length
+				const __mmask8 kTail = _mm512_test_epi64_mask(_mm512_loadu_si512(pLengths + nGroup * 8U), _mm512_set1_epi64(7));
+				zmmHash = _mm512_mask_mullo_epi64(zmmHash, kTail, _mm512_xor_si512(zmmHash, _mm512_loadu_si512(arrTails + nGroup * 8U)), zmmModulo);
+
+				zmmHash = _mm512_xor_si512(zmmHash, _mm512_maskz_srli_epi64(kAll, zmmHash, 47));
+				zmmHash = _mm512_mullo_epi64(zmmHash, zmmModulo);
+				zmmHash = _mm512_xor_si512(zmmHash, _mm512_maskz_srli_epi64(kAll, zmmHash, 47));
+
+				_mm512_storeu_si512(pResults + nGroup * 8U, zmmHash);
+			}
+		}
+	#endif
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr MurMur264_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, ullSeed);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
@@ -115,18 +227,22 @@ namespace MURMUR2_64
 	/// @returns: calculated hash of the given string
 	inline MurMur264_t Hash(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
 	{
-#ifdef Q_CRT
-		const std::size_t nLength = CRT::StringLength(szSource);
-#else
-		const std::size_t nLength = ::strlen(szSource);
-#endif
-		return Hash(reinterpret_cast<const std::uint8_t*>(szSource), nLength, ullSeed);
+		// length is mixed into the initial state, so the blocks can't be mixed before the terminator is found, but the vectorized search leaves them in the cache for the mixing
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [](const std::uint8_t*) { });
+		return DETAIL::HashBytes(reinterpret_cast<const std::uint8_t*>(szSource), nLength, ullSeed);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr MurMur264_t Hash(const std::string_view strSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), ullSeed);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] ullSeed initial key of the hash generation
 	/// @returns: calculated at compile-time hash of the given string
-	//template <typename T = char> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 	consteval MurMur264_t HashConst(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
 	{
 #ifdef Q_CRT
@@ -138,6 +254,204 @@ namespace MURMUR2_64
 
 		const std::size_t nLength = szSourceEnd - szSource;
 #endif
-		return DETAIL::ProcessBlock(szSource, nLength, ullSeed ^ (nLength * Q_HASH_MURMUR2_64_MODULO));
+		return DETAIL::HashBytes(szSource, nLength, ullSeed);
+	}
+
+	/* @section: batch */
+	namespace DETAIL
+	{
+		inline void HashBatchScalar(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur264_t* pResults, const std::uint64_t ullSeed) noexcept
+		{
+			// independent calls already overlap in the out-of-order execution, so the scalar chains are not interleaved manually
+			while (nCount-- != 0U)
+				*pResults++ = Hash(*ppSources++, *pLengths++, ullSeed);
+		}
+
+	#ifdef Q_HASH_MURMUR2_64_AVX512
+		inline void HashBatchAVX512(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur264_t* pResults, const std::uint64_t ullSeed) noexcept
+		{
+			for (; nCount >= nBatchLanes; nCount -= nBatchLanes)
+			{
+				HashLanesAVX512(ppSources, pLengths, pResults, ullSeed);
+				ppSources += nBatchLanes;
+				pLengths += nBatchLanes;
+				pResults += nBatchLanes;
+			}
+
+			HashBatchScalar(ppSources, pLengths, nCount, pResults, ullSeed);
+		}
+
+		using HashBatch_t = void(const std::uint8_t* const*, const std::size_t*, std::size_t, MurMur264_t*, std::uint64_t) noexcept;
+
+		inline HashBatch_t* ResolveHashBatch() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX512))
+				return &HashBatchAVX512;
+
+			return &HashBatchScalar;
+		}
+
+		using HashBatchDispatch_t = Q_HASH::CPU::CDispatch<HashBatch_t, &ResolveHashBatch>;
+	#endif
+	}
+
+	/// generate hashes of the many independent buffers at once, faster than hashing them one by one
+	/// @param[in] ppSources array of the buffers for which the hashes will be generated
+	/// @param[in] pLengths array of the length of each buffer in bytes
+	/// @param[in] nCount count of the buffers
+	/// @param[out] pResults array that receives calculated hash of each buffer, equal to the 'Hash' one
+	/// @param[in] ullSeed initial key of the hash generation
+	inline void HashBatch(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur264_t* pResults, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+	#ifdef Q_HASH_MURMUR2_64_AVX512
+		DETAIL::HashBatchDispatch_t::Call(ppSources, pLengths, nCount, pResults, ullSeed);
+	#else
+		DETAIL::HashBatchScalar(ppSources, pLengths, nCount, pResults, ullSeed);
+	#endif
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	/// @note: total length of the data must be known beforehand, as it is mixed into the initial state
+	class CStream
+	{
+	public:
+		/// @param[in] nTotalLength total length of all the buffers that will be appended, in bytes
+		/// @param[in] ullSeed initial key of the hash generation
+		explicit CStream(const std::size_t nTotalLength, const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			Init(nTotalLength, ullSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] nTotalLength total length of all the buffers that will be appended, in bytes
+		/// @param[in] ullSeed initial key of the hash generation
+		void Init(const std::size_t nTotalLength, const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			uHash = ullSeed ^ (nTotalLength * Q_HASH_MURMUR2_64_MODULO);
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			// complete the block that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				uHash = DETAIL::ProcessBody(arrTail, sizeof(arrTail), uHash);
+				nTailLength = 0U;
+			}
+
+			uHash = DETAIL::ProcessBody(pSource, nLength, uHash);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(7U)); nTailLength < (nLength & 7U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] MurMur264_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, uHash);
+		}
+
+	private:
+		MurMur264_t uHash;
+		std::uint8_t arrTail[sizeof(std::uint64_t)];
+		std::size_t nTailLength;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline MurMur264_t Hash(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(Q_HASH::FOLD::StringLength(szSource), ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline MurMur264_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(Q_HASH::FOLD::StringLength(szSource), ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval MurMur264_t HashConst(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval MurMur264_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
 	}
 }
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct MURMUR2_64
+	{
+		using Hash_t = MurMur264_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR2_64::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR2_64::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_murmur2_64'
+	consteval MurMur264_t operator""_murmur2_64(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return MURMUR2_64::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+}
+#endif
@@ -1,15 +1,29 @@
 #pragma once
+// used: [stl] size_t
+#include <cstddef>
 // used: [stl] uint32_t
 #include <cstdint>
 // used: [stl] endian, rotl
 #include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
 
 #if Q_HAS_INCLUDE("q-tee/crt/crt.h")
 // used: stringlength
 #include <q-tee/crt/crt.h>
-#else
-// used: [crt] strlen
-#include <cstring>
+#endif
+
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch, scanstring, transpose, loadblocks32, loadtail
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst, hashlength32
+#include "fold.h"
+
+#ifndef Q_HASH_MURMUR3_NO_AVX2
+#ifdef Q_HASH_CPU_X86
+#define Q_HASH_MURMUR3_AVX2
+#endif
 #endif
 
 #define Q_HASH_MURMUR3
@@ -44,106 +58,216 @@ namespace MURMUR3
 {
 	namespace DETAIL
 	{
-		consteval std::uint32_t XorShr(const std::uint32_t uValue, const std::uint32_t uShift) noexcept
+		/// @returns: endian-independent load of 4 bytes
+		template <typename T>
+		constexpr std::uint32_t LoadBlock(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint32_t*>(pSource);
+			}
+
+			return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[0])) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[1])) << 8U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[2])) << 16U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[3])) << 24U));
+		}
+
+		/// @returns: hash state after mixing the given block into it
+		constexpr MurMur3_t MixBlock(MurMur3_t uHash, std::uint32_t uBlock) noexcept
 		{
-			return uValue ^ (uValue >> uShift);
+			uBlock *= Q_HASH_MURMUR3_FIRST;
+			uBlock = std::rotl(uBlock, 15U);
+			uBlock *= Q_HASH_MURMUR3_SECOND;
+
+			uHash ^= uBlock;
+			uHash = std::rotl(uHash, 13U);
+			return uHash * 5U + Q_HASH_MURMUR3_THIRD;
 		}
 
-		consteval MurMur3_t Body(const char* szSource, const std::uint32_t nLength, const MurMur3_t uHash) noexcept
+		/// @param[in] pSource buffer of which only the whole blocks are processed
+		/// @returns: hash state after processing all the whole 4-byte blocks of the buffer
+		template <typename T>
+		constexpr MurMur3_t ProcessBody(const T* pSource, std::size_t nLength, MurMur3_t uHash) noexcept
 		{
-			return nLength >= 4U ? Body(szSource + 4U, nLength - 4U, std::rotl(uHash ^ (std::rotl((static_cast<std::uint32_t>(szSource[0]) | (static_cast<std::uint32_t>(szSource[1]) << 8U) | (static_cast<std::uint32_t>(szSource[2]) << 16U) | (static_cast<std::uint32_t>(szSource[3]) << 24U)) * Q_HASH_MURMUR3_FIRST, 15U) * Q_HASH_MURMUR3_SECOND), 13U) * 5U + Q_HASH_MURMUR3_THIRD) : uHash;
+			for (; nLength >= sizeof(std::uint32_t); nLength -= sizeof(std::uint32_t), pSource += sizeof(std::uint32_t))
+				uHash = MixBlock(uHash, LoadBlock(pSource));
+
+			return uHash;
 		}
 
-		consteval MurMur3_t Tail(const char* szSource, const std::uint32_t nLength, const MurMur3_t uHash) noexcept
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than block size
+		/// @param[in] nLength total length of the data in bytes
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr MurMur3_t ProcessTail(const T* pSource, const std::size_t nRemainingLength, MurMur3_t uHash, const std::uint32_t nLength) noexcept
 		{
-			return uHash ^ (std::rotl((nLength == 3U ? (szSource[0] | (szSource[1] << 8U) | (szSource[2] << 16U)) : nLength == 2U ? (szSource[0] | (szSource[1] << 8U)) : nLength == 1U ? szSource[0] : 0U) * Q_HASH_MURMUR3_FIRST, 15U) * Q_HASH_MURMUR3_SECOND);
+			// process the remaining length
+			std::uint32_t uTail = 0U;
+			switch (nRemainingLength)
+			{
+			case 3U:
+				uTail ^= static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[2])) << 16U;
+				[[fallthrough]];
+			case 2U:
+				uTail ^= static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[1])) << 8U;
+				[[fallthrough]];
+			case 1U:
+				uTail ^= static_cast<std::uint8_t>(pSource[0]);
+				uTail *= Q_HASH_MURMUR3_FIRST;
+				uTail = std::rotl(uTail, 15U);
+				uTail *= Q_HASH_MURMUR3_SECOND;
+				uHash ^= uTail;
+				break;
+			default:
+				break;
+			}
+
+			// finalize
+			uHash ^= nLength;
+			// force all bits of a hash block to avalanche
+			uHash ^= uHash >> 16U;
+			uHash *= Q_HASH_MURMUR3_AVALANCHE_FIRST;
+			uHash ^= uHash >> 13U;
+			uHash *= Q_HASH_MURMUR3_AVALANCHE_SECOND;
+			uHash ^= uHash >> 16U;
+			return uHash;
 		}
 
-		consteval MurMur3_t ProcessBlock(const char* szSource, const std::uint32_t nLength, const MurMur3_t uHash) noexcept
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr MurMur3_t HashBytes(const T* pSource, const std::uint32_t nLength, const std::uint32_t uSeed) noexcept
 		{
-			return XorShr(XorShr(XorShr(Tail(szSource + (nLength & ~3U), nLength & 3U, Body(szSource, nLength, uHash)) ^ nLength, 16U) * Q_HASH_MURMUR3_AVALANCHE_FIRST, 13U) * Q_HASH_MURMUR3_AVALANCHE_SECOND, 16U);
+			const MurMur3_t uHash = ProcessBody(pSource, nLength, uSeed);
+			return ProcessTail(pSource + (nLength & ~3U), nLength & 3U, uHash, nLength);
+		}
+
+	#ifdef Q_HASH_MURMUR3_AVX2
+		// count of the buffers processed at once by the vectorized batch
+		inline constexpr std::size_t nBatchLanes = 8U;
+
+		Q_HASH_TARGET("avx2") inline __m256i RotateLeft(const __m256i ymmValue, const int nShift) noexcept
+		{
+			return _mm256_or_si256(_mm256_slli_epi32(ymmValue, nShift), _mm256_srli_epi32(ymmValue, 32 - nShift));
+		}
+
+		/// generate hashes of the lanes with the each hash chain in the separate vector lane, where lanes that have run out of blocks are masked out
+		/// @returns: false if some of the buffers are too long to be processed by vector lanes, true otherwise
+		Q_HASH_TARGET("avx2") inline bool HashLanesAVX2(const std::uint8_t* const* ppSources, const std::size_t* pLengths, MurMur3_t* pResults, const std::uint32_t uSeed) noexcept
+		{
+			std::int32_t arrLengths[nBatchLanes], arrTails[nBatchLanes];
+			std::size_t nMaxBodyLength = 0U;
+
+			for (std::size_t nLane = 0U; nLane < nBatchLanes; ++nLane)
+			{
+				// lengths are kept in the signed 32-bit lanes, the longer buffers are left to the scalar batch
+				const std::size_t nLength = pLengths[nLane];
+				if (nLength > 0x7FFFFFFF)
+					return false;
+
+				arrLengths[nLane] = static_cast<std::int32_t>(nLength);
+
+				arrTails[nLane] = static_cast<std::int32_t>(Q_HASH::SIMD::LoadTail<std::uint32_t>(ppSources[nLane], nLength));
+
+				const std::size_t nBodyLength = nLength & ~static_cast<std::size_t>(3U);
+
+				nMaxBodyLength = (nBodyLength > nMaxBodyLength) ? nBodyLength : nMaxBodyLength;
+			}
+
+			const __m256i ymmLengths = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrLengths));
+			const __m256i ymmBodyBlocks = _mm256_srli_epi32(ymmLengths, 2);
+			const __m256i ymmFirst = _mm256_set1_epi32(static_cast<int>(Q_HASH_MURMUR3_FIRST));
+			const __m256i ymmSecond = _mm256_set1_epi32(static_cast<int>(Q_HASH_MURMUR3_SECOND));
+			const __m256i ymmThird = _mm256_set1_epi32(static_cast<int>(Q_HASH_MURMUR3_THIRD));
+			__m256i ymmHash = _mm256_set1_epi32(static_cast<int>(uSeed));
+
+			// process 8 blocks of each lane per iteration
+			for (std::size_t nOffset = 0U; nOffset < nMaxBodyLength; nOffset += sizeof(__m256i))
+			{
+				__m256i arrRows[nBatchLanes];
+				for (std::size_t nLane = 0U; nLane < nBatchLanes; ++nLane)
+				{
+					const int nRemainingBlocks = (arrLengths[nLane] - static_cast<int>(nOffset)) >> 2;
+					arrRows[nLane] = Q_HASH::SIMD::LoadBlocks32(nRemainingBlocks > 0 ? ppSources[nLane] + nOffset : ppSources[nLane], nRemainingBlocks);
+				}
+
+				Q_HASH::SIMD::Transpose(arrRows);
+
+				for (std::size_t nBlock = 0U; nBlock < 8U; ++nBlock)
+				{
+					const __m256i ymmActive = _mm256_cmpgt_epi32(ymmBodyBlocks, _mm256_set1_epi32(static_cast<int>((nOffset >> 2U) + nBlock)));
+
+					__m256i ymmBlock = _mm256_mullo_epi32(arrRows[nBlock], ymmFirst);
+					ymmBlock = RotateLeft(ymmBlock, 15);
+					ymmBlock = _mm256_mullo_epi32(ymmBlock, ymmSecond);
+
+					__m256i ymmMixed = _mm256_xor_si256(ymmHash, ymmBlock);
+					ymmMixed = RotateLeft(ymmMixed, 13);
+					ymmMixed = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(ymmMixed, 2), ymmMixed), ymmThird);
+					ymmHash = _mm256_blendv_epi8(ymmHash, ymmMixed, ymmActive);
+				}
+			}
+
+			// process the remaining length, lanes without it have zero tail that doesn't change the hash
+			__m256i ymmTail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(arrTails));
+			ymmTail = _mm256_mullo_epi32(ymmTail, ymmFirst);
+			ymmTail = RotateLeft(ymmTail, 15);
+			ymmTail = _mm256_mullo_epi32(ymmTail, ymmSecond);
+			ymmHash = _mm256_xor_si256(ymmHash, ymmTail);
+
+			// finalize
+			ymmHash = _mm256_xor_si256(ymmHash, ymmLengths);
+			// force all bits of a hash block to avalanche
+			ymmHash = _mm256_xor_si256(ymmHash, _mm256_srli_epi32(ymmHash, 16));
+			ymmHash = _mm256_mullo_epi32(ymmHash, _mm256_set1_epi32(static_cast<int>(Q_HASH_MURMUR3_AVALANCHE_FIRST)));
+			ymmHash = _mm256_xor_si256(ymmHash, _mm256_srli_epi32(ymmHash, 13));
+			ymmHash = _mm256_mullo_epi32(ymmHash, _mm256_set1_epi32(static_cast<int>(Q_HASH_MURMUR3_AVALANCHE_SECOND)));
+			ymmHash = _mm256_xor_si256(ymmHash, _mm256_srli_epi32(ymmHash, 16));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pResults), ymmHash);
+			return true;
 		}
+	#endif
 	}
 
 	/// @param[in] pSource buffer for which the hash will be generated
 	/// @param[in] nLength length of the source buffer in bytes
 	/// @param[in] uSeed initial key of the hash generation
 	/// @returns: calculated hash of the given buffer
-	inline MurMur3_t Hash(const std::uint8_t* pSource, const std::uint32_t nLength, const std::uint32_t uSeed = 0U) noexcept
+	constexpr MurMur3_t Hash(const std::uint8_t* pSource, const std::uint32_t nLength, const std::uint32_t uSeed = 0U) noexcept
 	{
-		MurMur3_t uHash = uSeed;
+		return DETAIL::HashBytes(pSource, nLength, uSeed);
+	}
 
-		std::uint32_t nRemainingLength = nLength;
-		while (nRemainingLength >= sizeof(std::uint32_t))
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline MurMur3_t Hash(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		// the seed is the initial state, so the whole blocks are mixed right behind the terminator search
+		MurMur3_t uHash = uSeed;
+		const std::uint8_t* pBlock = reinterpret_cast<const std::uint8_t*>(szSource);
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [&](const std::uint8_t* pSpanEnd)
 		{
-			// endian-independent load of 4 bytes
-			std::uint32_t uBlock;
-			if constexpr (std::endian::native == std::endian::little)
-				uBlock = *reinterpret_cast<const std::uint32_t*>(pSource);
-			else
-				uBlock = (static_cast<std::uint32_t>(pSource[0]) | (static_cast<std::uint32_t>(pSource[1]) << 8U) | (static_cast<std::uint32_t>(pSource[2]) << 16U) | (static_cast<std::uint32_t>(pSource[3]) << 24U));
+			const std::size_t nBodyLength = static_cast<std::size_t>(pSpanEnd - pBlock) & ~static_cast<std::size_t>(3U);
+			uHash = DETAIL::ProcessBody(pBlock, nBodyLength, uHash);
+			pBlock += nBodyLength;
+		});
 
-			uBlock *= Q_HASH_MURMUR3_FIRST;
-			uBlock = std::rotl(uBlock, 15U);
-			uBlock *= Q_HASH_MURMUR3_SECOND;
-
-			uHash ^= uBlock;
-			uHash = std::rotl(uHash, 13U);
-			uHash = uHash * 5U + Q_HASH_MURMUR3_THIRD;
-
-			pSource += sizeof(std::uint32_t);
-			nRemainingLength -= sizeof(std::uint32_t);
-		}
-
-		// process the remaining length
-		std::uint32_t uTail = 0U;
-		switch (nRemainingLength)
-		{
-		case 3U:
-			uTail ^= pSource[2] << 16U;
-			[[fallthrough]];
-		case 2U:
-			uTail ^= pSource[1] << 8U;
-			[[fallthrough]];
-		case 1U:
-			uTail ^= pSource[0];
-			uTail *= Q_HASH_MURMUR3_FIRST;
-			uTail = std::rotl(uTail, 15U);
-			uTail *= Q_HASH_MURMUR3_SECOND;
-			uHash ^= uTail;
-			break;
-		default:
-			break;
-		}
-
-		// finalize
-		uHash ^= nLength;
-		// force all bits of a hash block to avalanche
-		uHash ^= uHash >> 16U;
-		uHash *= Q_HASH_MURMUR3_AVALANCHE_FIRST;
-		uHash ^= uHash >> 13U;
-		uHash *= Q_HASH_MURMUR3_AVALANCHE_SECOND;
-		uHash ^= uHash >> 16U;
-		return uHash;
+		return DETAIL::ProcessTail(pBlock, nLength & 3U, uHash, static_cast<std::uint32_t>(nLength));
 	}
 
-	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] strSource string for which the hash will be generated
 	/// @param[in] uSeed initial key of the hash generation
 	/// @returns: calculated hash of the given string
-	inline MurMur3_t Hash(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	constexpr MurMur3_t Hash(const std::string_view strSource, const std::uint32_t uSeed = 0U) noexcept
 	{
-#ifdef Q_CRT
-		const std::size_t nLength = CRT::StringLength(szSource);
-#else
-		const std::size_t nLength = ::strlen(szSource);
-#endif
-		return Hash(reinterpret_cast<const std::uint8_t*>(szSource), static_cast<std::uint32_t>(nLength), uSeed);
+		return DETAIL::HashBytes(strSource.data(), static_cast<std::uint32_t>(strSource.size()), uSeed);
 	}
 
 	/// @param[in] szSource null-terminated string for which the hash will be generated
 	/// @param[in] uSeed initial key of the hash generation
 	/// @returns: calculated at compile-time hash of the given string
-	//template <typename T = char> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 	consteval MurMur3_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
 	{
 #ifdef Q_CRT
@@ -155,6 +279,204 @@ namespace MURMUR3
 
 		const std::size_t nLength = szSourceEnd - szSource;
 #endif
-		return DETAIL::ProcessBlock(szSource, static_cast<std::uint32_t>(nLength), uSeed);
+		return DETAIL::HashBytes(szSource, static_cast<std::uint32_t>(nLength), uSeed);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uSeed initial key of the hash generation
+		explicit CStream(const std::uint32_t uSeed = 0U) noexcept
+		{
+			Init(uSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uSeed initial key of the hash generation
+		void Init(const std::uint32_t uSeed = 0U) noexcept
+		{
+			uHash = uSeed;
+			nTotalLength = 0U;
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			nTotalLength += static_cast<std::uint32_t>(nLength);
+
+			// complete the block that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				uHash = DETAIL::ProcessBody(arrTail, sizeof(arrTail), uHash);
+				nTailLength = 0U;
+			}
+
+			uHash = DETAIL::ProcessBody(pSource, nLength, uHash);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(3U)); nTailLength < (nLength & 3U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] MurMur3_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, uHash, nTotalLength);
+		}
+
+	private:
+		MurMur3_t uHash;
+		std::uint32_t nTotalLength;
+		std::uint8_t arrTail[sizeof(std::uint32_t)];
+		std::size_t nTailLength;
+	};
+
+	/* @section: batch */
+	namespace DETAIL
+	{
+		inline void HashBatchScalar(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur3_t* pResults, const std::uint32_t uSeed) noexcept
+		{
+			// independent calls already overlap in the out-of-order execution, so the scalar chains are not interleaved manually
+			while (nCount-- != 0U)
+				*pResults++ = Q_HASH::FOLD::HashLength32(*ppSources++, *pLengths++, [uSeed](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return Hash(pBuffer, uLength, uSeed); }, [uSeed] { return CStream(uSeed); });
+		}
+
+	#ifdef Q_HASH_MURMUR3_AVX2
+		inline void HashBatchAVX2(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur3_t* pResults, const std::uint32_t uSeed) noexcept
+		{
+			for (; nCount >= nBatchLanes && HashLanesAVX2(ppSources, pLengths, pResults, uSeed); nCount -= nBatchLanes)
+			{
+				ppSources += nBatchLanes;
+				pLengths += nBatchLanes;
+				pResults += nBatchLanes;
+			}
+
+			HashBatchScalar(ppSources, pLengths, nCount, pResults, uSeed);
+		}
+
+		using HashBatch_t = void(const std::uint8_t* const*, const std::size_t*, std::size_t, MurMur3_t*, std::uint32_t) noexcept;
+
+		inline HashBatch_t* ResolveHashBatch() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &HashBatchAVX2;
+
+			return &HashBatchScalar;
+		}
+
+		using HashBatchDispatch_t = Q_HASH::CPU::CDispatch<HashBatch_t, &ResolveHashBatch>;
+	#endif
+	}
+
+	/// generate hashes of the many independent buffers at once, faster than hashing them one by one
+	/// @param[in] ppSources array of the buffers for which the hashes will be generated
+	/// @param[in] pLengths array of the length of each buffer in bytes
+	/// @param[in] nCount count of the buffers
+	/// @param[out] pResults array that receives calculated hash of each buffer, equal to the 'Hash' one
+	/// @param[in] uSeed initial key of the hash generation
+	inline void HashBatch(const std::uint8_t* const* ppSources, const std::size_t* pLengths, std::size_t nCount, MurMur3_t* pResults, const std::uint32_t uSeed = 0U) noexcept
+	{
+	#ifdef Q_HASH_MURMUR3_AVX2
+		DETAIL::HashBatchDispatch_t::Call(ppSources, pLengths, nCount, pResults, uSeed);
+	#else
+		DETAIL::HashBatchScalar(ppSources, pLengths, nCount, pResults, uSeed);
+	#endif
+	}
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline MurMur3_t Hash(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline MurMur3_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval MurMur3_t HashConst(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval MurMur3_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, static_cast<std::uint32_t>(nLength), uSeed); });
 	}
 }
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct MURMUR3
+	{
+		using Hash_t = MurMur3_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return Q_HASH::FOLD::HashLength32(pSource, nLength, [uSeed](const std::uint8_t* pBuffer, const std::uint32_t uLength) { return ::MURMUR3::Hash(pBuffer, uLength, uSeed); }, [uSeed] { return ::MURMUR3::CStream(uSeed); });
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR3::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_murmur3'
+	consteval MurMur3_t operator""_murmur3(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return MURMUR3::DETAIL::HashBytes(szSource, static_cast<std::uint32_t>(nLength), 0U);
+	}
+}
+#endif
@@ -0,0 +1,701 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] endian, rotl
+#include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+#if Q_HAS_INCLUDE("q-tee/crt/crt.h")
+// used: stringlength
+#include <q-tee/crt/crt.h>
+#endif
+
+// used: scanstring
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+#define Q_HASH_MURMUR3_128
+
+#ifndef Q_HASH_MURMUR3_128_FIRST
+#define Q_HASH_MURMUR3_128_FIRST 0x87C37B91114253D5
+#endif
+
+#ifndef Q_HASH_MURMUR3_128_SECOND
+#define Q_HASH_MURMUR3_128_SECOND 0x4CF5AD432745937F
+#endif
+
+#ifndef Q_HASH_MURMUR3_128_AVALANCHE_FIRST
+#define Q_HASH_MURMUR3_128_AVALANCHE_FIRST 0xFF51AFD7ED558CCD
+#endif
+
+#ifndef Q_HASH_MURMUR3_128_AVALANCHE_SECOND
+#define Q_HASH_MURMUR3_128_AVALANCHE_SECOND 0xC4CEB9FE1A85EC53
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_FIRST
+#define Q_HASH_MURMUR3_X86_128_FIRST 0x239B961B
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_SECOND
+#define Q_HASH_MURMUR3_X86_128_SECOND 0xAB0E9789
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_THIRD
+#define Q_HASH_MURMUR3_X86_128_THIRD 0x38B34AE5
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_FOURTH
+#define Q_HASH_MURMUR3_X86_128_FOURTH 0xA1E38B93
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_AVALANCHE_FIRST
+#define Q_HASH_MURMUR3_X86_128_AVALANCHE_FIRST 0x85EBCA6B
+#endif
+
+#ifndef Q_HASH_MURMUR3_X86_128_AVALANCHE_SECOND
+#define Q_HASH_MURMUR3_X86_128_AVALANCHE_SECOND 0xC2B2AE35
+#endif
+
+/// 128-bit hash, where the low half holds the first 8 bytes of the canonical little-endian output
+struct MurMur3128_t
+{
+	std::uint64_t ullLow;
+	std::uint64_t ullHigh;
+
+	constexpr bool operator==(const MurMur3128_t&) const noexcept = default;
+};
+
+/*
+ * 128-BIT MURMUR3 HASH ALGORITHM, OPTIMIZED FOR THE 64-BIT CPUS (X64_128)
+ * @credits: Austin Appleby
+ */
+namespace MURMUR3_128
+{
+	namespace DETAIL
+	{
+		/// @returns: endian-independent load of the given count of bytes, up to 8
+		template <typename T>
+		constexpr std::uint64_t LoadBytes(const T* pSource, const std::size_t nLength) noexcept
+		{
+			std::uint64_t ullResult = 0U;
+			for (std::size_t i = 0U; i < nLength; ++i)
+				ullResult |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
+
+			return ullResult;
+		}
+
+		/// @returns: endian-independent load of 8 bytes
+		template <typename T>
+		constexpr std::uint64_t LoadBlock(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint64_t*>(pSource);
+			}
+
+			return LoadBytes(pSource, sizeof(std::uint64_t));
+		}
+
+		constexpr std::uint64_t MixFirst(std::uint64_t ullBlock) noexcept
+		{
+			ullBlock *= Q_HASH_MURMUR3_128_FIRST;
+			ullBlock = std::rotl(ullBlock, 31);
+			return ullBlock * Q_HASH_MURMUR3_128_SECOND;
+		}
+
+		constexpr std::uint64_t MixSecond(std::uint64_t ullBlock) noexcept
+		{
+			ullBlock *= Q_HASH_MURMUR3_128_SECOND;
+			ullBlock = std::rotl(ullBlock, 33);
+			return ullBlock * Q_HASH_MURMUR3_128_FIRST;
+		}
+
+		/// force all bits of a hash block to avalanche
+		constexpr std::uint64_t Avalanche(std::uint64_t ullHash) noexcept
+		{
+			ullHash ^= ullHash >> 33U;
+			ullHash *= Q_HASH_MURMUR3_128_AVALANCHE_FIRST;
+			ullHash ^= ullHash >> 33U;
+			ullHash *= Q_HASH_MURMUR3_128_AVALANCHE_SECOND;
+			ullHash ^= ullHash >> 33U;
+			return ullHash;
+		}
+
+		/// mix the 16-byte block, given as two 8-byte halves, into the hash state
+		constexpr void MixBlock(MurMur3128_t& hash, const std::uint64_t ullFirst, const std::uint64_t ullSecond) noexcept
+		{
+			hash.ullLow ^= MixFirst(ullFirst);
+			hash.ullLow = std::rotl(hash.ullLow, 27);
+			hash.ullLow += hash.ullHigh;
+			hash.ullLow = hash.ullLow * 5U + 0x52DCE729;
+
+			hash.ullHigh ^= MixSecond(ullSecond);
+			hash.ullHigh = std::rotl(hash.ullHigh, 31);
+			hash.ullHigh += hash.ullLow;
+			hash.ullHigh = hash.ullHigh * 5U + 0x38495AB5;
+		}
+
+		/// @param[in] pSource buffer of which only the whole blocks are processed
+		/// @returns: hash state after processing all the whole 16-byte blocks of the buffer
+		template <typename T>
+		constexpr MurMur3128_t ProcessBody(const T* pSource, std::size_t nLength, MurMur3128_t hash) noexcept
+		{
+			for (; nLength >= sizeof(std::uint64_t) * 2U; nLength -= sizeof(std::uint64_t) * 2U, pSource += sizeof(std::uint64_t) * 2U)
+				MixBlock(hash, LoadBlock(pSource), LoadBlock(pSource + sizeof(std::uint64_t)));
+
+			return hash;
+		}
+
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than block size
+		/// @param[in] nLength total length of the data in bytes
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr MurMur3128_t ProcessTail(const T* pSource, const std::size_t nRemainingLength, MurMur3128_t hash, const std::size_t nLength) noexcept
+		{
+			// process the remaining length, the zero halves don't change the hash
+			hash.ullLow ^= MixFirst(LoadBytes(pSource, nRemainingLength < 8U ? nRemainingLength : 8U));
+			hash.ullHigh ^= MixSecond(nRemainingLength > 8U ? LoadBytes(pSource + 8U, nRemainingLength - 8U) : 0U);
+
+			// finalize
+			hash.ullLow ^= static_cast<std::uint64_t>(nLength);
+			hash.ullHigh ^= static_cast<std::uint64_t>(nLength);
+
+			hash.ullLow += hash.ullHigh;
+			hash.ullHigh += hash.ullLow;
+
+			hash.ullLow = Avalanche(hash.ullLow);
+			hash.ullHigh = Avalanche(hash.ullHigh);
+
+			hash.ullLow += hash.ullHigh;
+			hash.ullHigh += hash.ullLow;
+			return hash;
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr MurMur3128_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint32_t uSeed) noexcept
+		{
+			const MurMur3128_t hash = ProcessBody(pSource, nLength, { uSeed, uSeed });
+			return ProcessTail(pSource + (nLength & ~static_cast<std::size_t>(15U)), nLength & 15U, hash, nLength);
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr MurMur3128_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, uSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline MurMur3128_t Hash(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		// the seed is the initial state, so the whole blocks are mixed right behind the terminator search
+		MurMur3128_t hash = { uSeed, uSeed };
+		const std::uint8_t* pBlock = reinterpret_cast<const std::uint8_t*>(szSource);
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [&](const std::uint8_t* pSpanEnd)
+		{
+			const std::size_t nBodyLength = static_cast<std::size_t>(pSpanEnd - pBlock) & ~static_cast<std::size_t>(15U);
+			hash = DETAIL::ProcessBody(pBlock, nBodyLength, hash);
+			pBlock += nBodyLength;
+		});
+
+		return DETAIL::ProcessTail(pBlock, nLength & 15U, hash, nLength);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr MurMur3128_t Hash(const std::string_view strSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), uSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval MurMur3128_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		const char* szSourceEnd = szSource;
+		while (*szSourceEnd != '\0')
+			++szSourceEnd;
+
+		return DETAIL::HashBytes(szSource, static_cast<std::size_t>(szSourceEnd - szSource), uSeed);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uSeed initial key of the hash generation
+		explicit CStream(const std::uint32_t uSeed = 0U) noexcept
+		{
+			Init(uSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uSeed initial key of the hash generation
+		void Init(const std::uint32_t uSeed = 0U) noexcept
+		{
+			hash = { uSeed, uSeed };
+			nTotalLength = 0U;
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			nTotalLength += nLength;
+
+			// complete the block that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				hash = DETAIL::ProcessBody(arrTail, sizeof(arrTail), hash);
+				nTailLength = 0U;
+			}
+
+			hash = DETAIL::ProcessBody(pSource, nLength, hash);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(15U)); nTailLength < (nLength & 15U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] MurMur3128_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, hash, nTotalLength);
+		}
+
+	private:
+		MurMur3128_t hash;
+		std::size_t nTotalLength;
+		std::uint8_t arrTail[sizeof(std::uint64_t) * 2U];
+		std::size_t nTailLength;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline MurMur3128_t Hash(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline MurMur3128_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval MurMur3128_t HashConst(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval MurMur3128_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uSeed); });
+	}
+}
+
+/*
+ * 128-BIT MURMUR3 HASH ALGORITHM, OPTIMIZED FOR THE 32-BIT CPUS (X86_128)
+ * @credits: Austin Appleby
+ * @note: produces different hashes than the 'MURMUR3_128' one
+ */
+namespace MURMUR3_X86_128
+{
+	namespace DETAIL
+	{
+		/// @returns: endian-independent load of the given count of bytes, up to 4
+		template <typename T>
+		constexpr std::uint32_t LoadBytes(const T* pSource, const std::size_t nLength) noexcept
+		{
+			std::uint32_t uResult = 0U;
+			for (std::size_t i = 0U; i < nLength; ++i)
+				uResult |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
+
+			return uResult;
+		}
+
+		/// @returns: endian-independent load of 4 bytes
+		template <typename T>
+		constexpr std::uint32_t LoadBlock(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint32_t*>(pSource);
+			}
+
+			return LoadBytes(pSource, sizeof(std::uint32_t));
+		}
+
+		/// 32-bit lanes of the hash state
+		struct State_t
+		{
+			std::uint32_t arrLanes[4];
+		};
+
+		// multipliers of the each lane, where the next lane's multiplier is used after the rotation
+		inline constexpr std::uint32_t arrMultipliers[5] = { Q_HASH_MURMUR3_X86_128_FIRST, Q_HASH_MURMUR3_X86_128_SECOND, Q_HASH_MURMUR3_X86_128_THIRD, Q_HASH_MURMUR3_X86_128_FOURTH, Q_HASH_MURMUR3_X86_128_FIRST };
+		inline constexpr int arrBlockRotations[4] = { 15, 16, 17, 18 };
+		inline constexpr int arrHashRotations[4] = { 19, 17, 15, 13 };
+		inline constexpr std::uint32_t arrAdditions[4] = { 0x561CCD1B, 0x0BCAA747, 0x96CD1C35, 0x32AC3B17 };
+
+		constexpr std::uint32_t MixLane(const std::size_t nLane, std::uint32_t uBlock) noexcept
+		{
+			uBlock *= arrMultipliers[nLane];
+			uBlock = std::rotl(uBlock, arrBlockRotations[nLane]);
+			return uBlock * arrMultipliers[nLane + 1U];
+		}
+
+		/// force all bits of a hash block to avalanche
+		constexpr std::uint32_t Avalanche(std::uint32_t uHash) noexcept
+		{
+			uHash ^= uHash >> 16U;
+			uHash *= Q_HASH_MURMUR3_X86_128_AVALANCHE_FIRST;
+			uHash ^= uHash >> 13U;
+			uHash *= Q_HASH_MURMUR3_X86_128_AVALANCHE_SECOND;
+			uHash ^= uHash >> 16U;
+			return uHash;
+		}
+
+		/// mix the 16-byte block, given as four 4-byte words, into the hash state
+		constexpr void MixBlock(State_t& state, const std::uint32_t (&arrBlocks)[4]) noexcept
+		{
+			for (std::size_t nLane = 0U; nLane < 4U; ++nLane)
+			{
+				std::uint32_t& uHash = state.arrLanes[nLane];
+				uHash ^= MixLane(nLane, arrBlocks[nLane]);
+				uHash = std::rotl(uHash, arrHashRotations[nLane]);
+				uHash += state.arrLanes[(nLane + 1U) & 3U];
+				uHash = uHash * 5U + arrAdditions[nLane];
+			}
+		}
+
+		/// @param[in] pSource buffer of which only the whole blocks are processed
+		/// @returns: hash state after processing all the whole 16-byte blocks of the buffer
+		template <typename T>
+		constexpr State_t ProcessBody(const T* pSource, std::size_t nLength, State_t state) noexcept
+		{
+			for (; nLength >= sizeof(std::uint32_t) * 4U; nLength -= sizeof(std::uint32_t) * 4U, pSource += sizeof(std::uint32_t) * 4U)
+			{
+				const std::uint32_t arrBlocks[4] = { LoadBlock(pSource), LoadBlock(pSource + 4U), LoadBlock(pSource + 8U), LoadBlock(pSource + 12U) };
+				MixBlock(state, arrBlocks);
+			}
+
+			return state;
+		}
+
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than block size
+		/// @param[in] nLength total length of the data in bytes
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr MurMur3128_t ProcessTail(const T* pSource, const std::size_t nRemainingLength, State_t state, const std::size_t nLength) noexcept
+		{
+			// process the remaining length, the zero words don't change the hash
+			for (std::size_t nLane = 0U; nLane * 4U < nRemainingLength; ++nLane)
+			{
+				const std::size_t nWordLength = nRemainingLength - nLane * 4U;
+				state.arrLanes[nLane] ^= MixLane(nLane, LoadBytes(pSource + nLane * 4U, nWordLength < 4U ? nWordLength : 4U));
+			}
+
+			// finalize
+			for (std::uint32_t& uHash : state.arrLanes)
+				uHash ^= static_cast<std::uint32_t>(nLength);
+
+			std::uint32_t& h1 = state.arrLanes[0];
+			std::uint32_t& h2 = state.arrLanes[1];
+			std::uint32_t& h3 = state.arrLanes[2];
+			std::uint32_t& h4 = state.arrLanes[3];
+
+			h1 += h2 + h3 + h4;
+			h2 += h1; h3 += h1; h4 += h1;
+
+			h1 = Avalanche(h1);
+			h2 = Avalanche(h2);
+			h3 = Avalanche(h3);
+			h4 = Avalanche(h4);
+
+			h1 += h2 + h3 + h4;
+			h2 += h1; h3 += h1; h4 += h1;
+
+			return { static_cast<std::uint64_t>(h1) | (static_cast<std::uint64_t>(h2) << 32U), static_cast<std::uint64_t>(h3) | (static_cast<std::uint64_t>(h4) << 32U) };
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr MurMur3128_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint32_t uSeed) noexcept
+		{
+			const State_t state = ProcessBody(pSource, nLength, { { uSeed, uSeed, uSeed, uSeed } });
+			return ProcessTail(pSource + (nLength & ~static_cast<std::size_t>(15U)), nLength & 15U, state, nLength);
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr MurMur3128_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, uSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline MurMur3128_t Hash(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		// the seed is the initial state, so the whole blocks are mixed right behind the terminator search
+		DETAIL::State_t state = { { uSeed, uSeed, uSeed, uSeed } };
+		const std::uint8_t* pBlock = reinterpret_cast<const std::uint8_t*>(szSource);
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [&](const std::uint8_t* pSpanEnd)
+		{
+			const std::size_t nBodyLength = static_cast<std::size_t>(pSpanEnd - pBlock) & ~static_cast<std::size_t>(15U);
+			state = DETAIL::ProcessBody(pBlock, nBodyLength, state);
+			pBlock += nBodyLength;
+		});
+
+		return DETAIL::ProcessTail(pBlock, nLength & 15U, state, nLength);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr MurMur3128_t Hash(const std::string_view strSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), uSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval MurMur3128_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		const char* szSourceEnd = szSource;
+		while (*szSourceEnd != '\0')
+			++szSourceEnd;
+
+		return DETAIL::HashBytes(szSource, static_cast<std::size_t>(szSourceEnd - szSource), uSeed);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] uSeed initial key of the hash generation
+		explicit CStream(const std::uint32_t uSeed = 0U) noexcept
+		{
+			Init(uSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] uSeed initial key of the hash generation
+		void Init(const std::uint32_t uSeed = 0U) noexcept
+		{
+			state = { { uSeed, uSeed, uSeed, uSeed } };
+			nTotalLength = 0U;
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			nTotalLength += nLength;
+
+			// complete the block that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				state = DETAIL::ProcessBody(arrTail, sizeof(arrTail), state);
+				nTailLength = 0U;
+			}
+
+			state = DETAIL::ProcessBody(pSource, nLength, state);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(15U)); nTailLength < (nLength & 15U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] MurMur3128_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, state, nTotalLength);
+		}
+
+	private:
+		DETAIL::State_t state;
+		std::size_t nTotalLength;
+		std::uint8_t arrTail[sizeof(std::uint32_t) * 4U];
+		std::size_t nTailLength;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline MurMur3128_t Hash(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline MurMur3128_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(uSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval MurMur3128_t HashConst(const TChar* szSource, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] uSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval MurMur3128_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint32_t uSeed = 0U) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [uSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, uSeed); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct MURMUR3_128
+	{
+		using Hash_t = MurMur3128_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR3_128::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR3_128::HashConst(szSource, uSeed);
+		}
+	};
+
+	struct MURMUR3_X86_128
+	{
+		using Hash_t = MurMur3128_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR3_X86_128::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::MURMUR3_X86_128::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_murmur3_128'
+	consteval MurMur3128_t operator""_murmur3_128(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return MURMUR3_128::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_murmur3_x86_128'
+	consteval MurMur3128_t operator""_murmur3_x86_128(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return MURMUR3_X86_128::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+}
+#endif
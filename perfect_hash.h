@@ -0,0 +1,244 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] array
+#include <array>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_integral_v
+#include <type_traits>
+
+#define Q_HASH_PERFECT_HASH
+
+/*
+ * COMPILE-TIME MINIMAL PERFECT HASH OF THE FIXED SET OF STRINGS
+ * @note: keys are spread over the buckets of about two keys by the seeded hash, then buckets are placed from the largest one by searching the pilot value that moves all keys of the bucket to the free slots, so the lookup is one hash, one pilot read and one slot read with the key comparison
+ * @credits: Giulio Ermanno Pibiri, Roberto Trani - PTHash
+ */
+namespace Q_HASH
+{
+	namespace DETAIL
+	{
+		// count of the seeds that are tried before the generation gives up
+		inline constexpr std::uint32_t nPerfectHashSeedCount = 64U;
+
+		/* @section: diagnostics */
+		// these are deliberately not constexpr, so reaching any of them during the constant evaluation fails the compilation with its name in the error
+		inline void ErrorPerfectHashDuplicateKey() noexcept { }
+		inline void ErrorPerfectHashNoSeedFound() noexcept { }
+
+		/// force all bits of the hash to avalanche
+		constexpr std::uint64_t PerfectHashMix(std::uint64_t ullHash) noexcept
+		{
+			ullHash ^= ullHash >> 33U;
+			ullHash *= 0xFF51AFD7ED558CCD;
+			ullHash ^= ullHash >> 33U;
+			ullHash *= 0xC4CEB9FE1A85EC53;
+			ullHash ^= ullHash >> 33U;
+			return ullHash;
+		}
+
+		/// @returns: hash of any supported width, reduced to the 64-bit value with all bits avalanched
+		template <typename T>
+		constexpr std::uint64_t PerfectHashKey(const T& hash) noexcept
+		{
+			if constexpr (std::is_integral_v<T>)
+				return PerfectHashMix(static_cast<std::uint64_t>(hash));
+			else
+				return PerfectHashMix(hash.ullLow);
+		}
+
+		/// @returns: slot of the key with given mixed hash, moved by the pilot of its bucket
+		constexpr std::size_t PerfectHashSlot(const std::uint64_t ullKey, const std::uint16_t uPilot, const std::size_t nSlotCount) noexcept
+		{
+			return static_cast<std::size_t>(PerfectHashMix(ullKey ^ (static_cast<std::uint64_t>(uPilot) * 0x9E3779B97F4A7C15)) % nSlotCount);
+		}
+
+		constexpr bool IsStringEqual(const char* szFirst, const char* szSecond) noexcept
+		{
+			while (*szFirst != '\0' && *szFirst == *szSecond)
+				++szFirst, ++szSecond;
+
+			return *szFirst == *szSecond;
+		}
+
+		constexpr std::size_t StringLength(const char* szSource) noexcept
+		{
+			const char* szSourceEnd = szSource;
+			while (*szSourceEnd != '\0')
+				++szSourceEnd;
+
+			return szSourceEnd - szSource;
+		}
+	}
+
+	/// minimal perfect hash table, that maps each of N strings known at compile-time to its index in the original list
+	/// @note: built with the 'HashConst' of the given algorithm and looked up with its runtime 'Hash', which must give the same results
+	template <typename TAlgorithm, std::size_t N>
+	class CPerfectHash
+	{
+		static_assert(N > 0U, "perfect hash requires at least one key");
+
+	public:
+		// count of the pilots, the average of two keys per bucket keeps both the table and the search time small
+		static constexpr std::size_t nBucketCount = (N + 1U) / 2U;
+
+		/// @param[in] arrKeys list of the distinct null-terminated strings
+		consteval explicit CPerfectHash(const char* const (&arrKeys)[N])
+		{
+			for (std::uint32_t uTrySeed = 0U; uTrySeed < DETAIL::nPerfectHashSeedCount; ++uTrySeed)
+			{
+				if (TryBuild(arrKeys, uTrySeed))
+					return;
+			}
+
+			DETAIL::ErrorPerfectHashNoSeedFound();
+		}
+
+		/// @param[in] strKey string to look up
+		/// @returns: index of the key in the list the table was built from, or the count of keys if the string isn't one of them
+		[[nodiscard]] std::size_t Find(const std::string_view strKey) const noexcept
+		{
+			const std::uint64_t ullKey = DETAIL::PerfectHashKey(TAlgorithm::Hash(reinterpret_cast<const std::uint8_t*>(strKey.data()), strKey.size(), uSeed));
+			const Slot_t& slot = arrSlots[DETAIL::PerfectHashSlot(ullKey, arrPilots[(ullKey >> 32U) % nBucketCount], N)];
+			return (slot.strKey == strKey) ? slot.nIndex : N;
+		}
+
+		/// @returns: count of the keys in the table
+		[[nodiscard]] static constexpr std::size_t Size() noexcept
+		{
+			return N;
+		}
+
+		/// @returns: seed that the algorithm is called with for the lookups
+		[[nodiscard]] constexpr std::uint32_t Seed() const noexcept
+		{
+			return uSeed;
+		}
+
+	private:
+		struct Slot_t
+		{
+			std::string_view strKey = { };
+			std::size_t nIndex = N;
+		};
+
+		/// try to place all keys with given seed
+		/// @returns: true if every bucket has found its pilot, false otherwise
+		consteval bool TryBuild(const char* const (&arrKeys)[N], const std::uint32_t uTrySeed)
+		{
+			std::array<std::uint64_t, N> arrHashes = { };
+			for (std::size_t i = 0U; i < N; ++i)
+				arrHashes[i] = DETAIL::PerfectHashKey(TAlgorithm::HashConst(arrKeys[i], uTrySeed));
+
+			// group the keys by buckets with the counting sort
+			std::array<std::size_t, nBucketCount + 1U> arrBucketStart = { };
+			for (std::size_t i = 0U; i < N; ++i)
+				++arrBucketStart[(arrHashes[i] >> 32U) % nBucketCount + 1U];
+
+			std::size_t nMaxBucketSize = 0U;
+			for (std::size_t i = 0U; i < nBucketCount; ++i)
+			{
+				if (arrBucketStart[i + 1U] > nMaxBucketSize)
+					nMaxBucketSize = arrBucketStart[i + 1U];
+
+				arrBucketStart[i + 1U] += arrBucketStart[i];
+			}
+
+			std::array<std::size_t, N> arrBucketKeys = { };
+			std::array<std::size_t, nBucketCount> arrBucketFill = { };
+			for (std::size_t i = 0U; i < N; ++i)
+			{
+				const std::size_t nBucket = (arrHashes[i] >> 32U) % nBucketCount;
+				arrBucketKeys[arrBucketStart[nBucket] + arrBucketFill[nBucket]++] = i;
+			}
+
+			std::array<bool, N> arrTaken = { };
+			std::array<std::size_t, 16U> arrPlaced = { };
+			arrPilots = { };
+
+			// the larger buckets have less freedom, so they are placed first while most of the slots are still free
+			for (std::size_t nBucketSize = nMaxBucketSize; nBucketSize > 0U; --nBucketSize)
+			{
+				// bucket that is too big to be placed is very unlikely, but is handled by the next seed
+				if (nBucketSize > arrPlaced.size())
+					return false;
+
+				for (std::size_t nBucket = 0U; nBucket < nBucketCount; ++nBucket)
+				{
+					const std::size_t nBegin = arrBucketStart[nBucket];
+					if (arrBucketStart[nBucket + 1U] - nBegin != nBucketSize)
+						continue;
+
+					// keys with the same hash always share the bucket and can't be told apart by any pilot, it's either the duplicate key or the collision of this seed
+					for (std::size_t i = 0U; i < nBucketSize; ++i)
+					{
+						for (std::size_t j = i + 1U; j < nBucketSize; ++j)
+						{
+							const std::size_t nFirst = arrBucketKeys[nBegin + i], nSecond = arrBucketKeys[nBegin + j];
+							if (arrHashes[nFirst] != arrHashes[nSecond])
+								continue;
+
+							if (DETAIL::IsStringEqual(arrKeys[nFirst], arrKeys[nSecond]))
+								DETAIL::ErrorPerfectHashDuplicateKey();
+
+							return false;
+						}
+					}
+
+					bool bPlaced = false;
+					for (std::uint32_t uPilot = 0U; uPilot <= 0xFFFFU && !bPlaced; ++uPilot)
+					{
+						bPlaced = true;
+						for (std::size_t i = 0U; i < nBucketSize; ++i)
+						{
+							const std::size_t nSlot = DETAIL::PerfectHashSlot(arrHashes[arrBucketKeys[nBegin + i]], static_cast<std::uint16_t>(uPilot), N);
+
+							bool bCollide = arrTaken[nSlot];
+							for (std::size_t j = 0U; j < i && !bCollide; ++j)
+								bCollide = (arrPlaced[j] == nSlot);
+
+							if (bCollide)
+							{
+								bPlaced = false;
+								break;
+							}
+
+							arrPlaced[i] = nSlot;
+						}
+
+						if (bPlaced)
+							arrPilots[nBucket] = static_cast<std::uint16_t>(uPilot);
+					}
+
+					if (!bPlaced)
+						return false;
+
+					for (std::size_t i = 0U; i < nBucketSize; ++i)
+					{
+						const std::size_t nKey = arrBucketKeys[nBegin + i];
+						arrTaken[arrPlaced[i]] = true;
+						arrSlots[arrPlaced[i]] = { std::string_view(arrKeys[nKey], DETAIL::StringLength(arrKeys[nKey])), nKey };
+					}
+				}
+			}
+
+			uSeed = uTrySeed;
+			return true;
+		}
+
+		std::uint32_t uSeed = 0U;
+		std::array<std::uint16_t, nBucketCount> arrPilots = { };
+		std::array<Slot_t, N> arrSlots = { };
+	};
+
+	/// @param[in] arrKeys list of the distinct null-terminated strings, e.g. '{ "first", "second" }'
+	/// @returns: minimal perfect hash table of the given keys, that is built with the given algorithm at compile-time
+	template <typename TAlgorithm, std::size_t N>
+	consteval CPerfectHash<TAlgorithm, N> MakePerfectHash(const char* const (&arrKeys)[N])
+	{
+		return CPerfectHash<TAlgorithm, N>(arrKeys);
+	}
+}
@@ -0,0 +1,386 @@
+/*
+ * COMMAND-LINE HASHING OF THE FILES AND DIRECTORY TREES WITH ANY HASH ALGORITHM
+ * build, from the repository root:
+ *   g++ -std=c++20 -O2 -pthread qhash/qhash.cpp -o qhash
+ *   cl /std:c++20 /O2 /EHsc qhash\qhash.cpp /Fe:qhash.exe
+ * usage:
+ *   qhash [--algo <name>] [--threads <count>] <path>...
+ * where directories are hashed recursively, each file gets its own hash printed as "<hash>  <path>" in the order of paths, and the aggregate throughput goes to the standard error
+ * @note: on POSIX systems the large files are memory-mapped and read ahead sequentially, while the small files are read with 'pread' by the pool of threads, so the device always has about as many requests in flight as there are threads
+ */
+#ifndef Q_HAS_INCLUDE
+#define Q_HAS_INCLUDE(HEADER) __has_include(HEADER)
+#endif
+
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] printf, fprintf, fopen, fread, fclose
+#include <cstdio>
+// used: [crt] strcmp
+#include <cstring>
+// used: [crt] strtoul
+#include <cstdlib>
+// used: [stl] sort, min
+#include <algorithm>
+// used: [stl] atomic
+#include <atomic>
+// used: [stl] steady_clock
+#include <chrono>
+// used: [stl] path, recursive_directory_iterator, is_directory
+#include <filesystem>
+// used: [stl] numeric_limits
+#include <limits>
+// used: [stl] string
+#include <string>
+// used: [stl] thread
+#include <thread>
+// used: [stl] vector
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+// used: [posix] open, O_RDONLY, O_CLOEXEC
+#include <fcntl.h>
+// used: [posix] mmap, madvise, munmap
+#include <sys/mman.h>
+// used: [posix] fstat
+#include <sys/stat.h>
+// used: [posix] pread, close
+#include <unistd.h>
+
+#define Q_QHASH_POSIX
+#endif
+
+#include "../crc32.h"
+#include "../crc32c.h"
+#include "../crc64.h"
+#include "../djb2.h"
+#include "../djb2a.h"
+#include "../fnv1a.h"
+#include "../fnv1a_64.h"
+#include "../murmur2.h"
+#include "../murmur2a.h"
+#include "../murmur2_64.h"
+#include "../murmur3.h"
+#include "../murmur3_128.h"
+#include "../xxh64.h"
+#include "../xxh3.h"
+
+namespace QHASH
+{
+	// files of this size and larger are memory-mapped instead of being read into the buffer
+	inline constexpr std::uint64_t ullMapThreshold = 1U << 20U;
+
+	/* @section: algorithms */
+	/// hash of any width, where the narrower ones are held in the low half
+	struct Digest_t
+	{
+		std::uint64_t ullLow;
+		std::uint64_t ullHigh;
+	};
+
+	struct Algorithm_t
+	{
+		const char* szName;
+		// width of the hash in bits, that gives the count of the printed digits
+		int nBits;
+		Digest_t(*pfnHash)(const std::uint8_t*, std::size_t) noexcept;
+	};
+
+	template <typename T>
+	constexpr Digest_t ToDigest(const T uHash) noexcept
+	{
+		return { static_cast<std::uint64_t>(uHash), 0U };
+	}
+
+	// the canonical form of MurMur3 128 is the bytes of its halves in the little-endian order, as the reference 'hash_bytes' gives them
+	constexpr Digest_t ToDigest(const MurMur3128_t hash) noexcept
+	{
+		return { XXH3::DETAIL::ByteSwap64(hash.ullLow), XXH3::DETAIL::ByteSwap64(hash.ullHigh) };
+	}
+
+	// the canonical form of XXH3 128 starts with the high half, as 'xxhsum -H2' prints it
+	constexpr Digest_t ToDigest(const XXH3128_t hash) noexcept
+	{
+		return { hash.ullHigh, hash.ullLow };
+	}
+
+#define QHASH_ENTRY(NAME, NAMESPACE, BITS) { NAME, BITS, [](const std::uint8_t* pSource, const std::size_t nLength) noexcept { return ToDigest(NAMESPACE::Hash(pSource, nLength)); } }
+// the one-shot functions of these algorithms take 32-bit length, so the files of 4 GiB and larger go through the uniform interface, that continues them through the stream
+#define QHASH_ENTRY_LENGTH32(NAME, NAMESPACE, BITS) { NAME, BITS, [](const std::uint8_t* pSource, const std::size_t nLength) noexcept { return ToDigest(Q_HASH::ALGORITHM::NAMESPACE::Hash(pSource, nLength)); } }
+
+	inline constexpr Algorithm_t arrAlgorithms[] =
+	{
+		QHASH_ENTRY("crc32", CRC32, 32),
+		QHASH_ENTRY("crc32c", CRC32C, 32),
+		QHASH_ENTRY("crc64", CRC64, 64),
+		QHASH_ENTRY_LENGTH32("djb2", DJB2, 32),
+		QHASH_ENTRY_LENGTH32("djb2a", DJB2A, 32),
+		QHASH_ENTRY_LENGTH32("fnv1a", FNV1A, 32),
+		QHASH_ENTRY("fnv1a_64", FNV1A_64, 64),
+		QHASH_ENTRY_LENGTH32("murmur2", MURMUR2, 32),
+		QHASH_ENTRY_LENGTH32("murmur2a", MURMUR2A, 32),
+		QHASH_ENTRY("murmur2_64", MURMUR2_64, 64),
+		QHASH_ENTRY_LENGTH32("murmur3", MURMUR3, 32),
+		QHASH_ENTRY("murmur3_128", MURMUR3_128, 128),
+		QHASH_ENTRY("murmur3_x86_128", MURMUR3_X86_128, 128),
+		QHASH_ENTRY("xxh64", XXH64, 64),
+		QHASH_ENTRY("xxh3", XXH3, 64),
+		QHASH_ENTRY("xxh3_128", XXH3_128, 128)
+	};
+
+	/* @section: files */
+	struct File_t
+	{
+		std::string strPath;
+		std::uint64_t ullSize = 0U;
+		Digest_t digest = { };
+		// description of the failure, or null if the file has been hashed
+		const char* szError = nullptr;
+	};
+
+	/// @param[in] path file or directory, which regular files are appended recursively
+	/// @returns: true if the path exists, false otherwise
+	bool CollectFiles(const std::filesystem::path& path, std::vector<File_t>& vecFiles)
+	{
+		std::error_code error;
+		if (!std::filesystem::is_directory(path, error))
+		{
+			if (!std::filesystem::exists(path, error))
+				return false;
+
+			vecFiles.push_back({ path.string() });
+			return true;
+		}
+
+		for (std::filesystem::recursive_directory_iterator it(path, std::filesystem::directory_options::skip_permission_denied, error), itEnd; !error && it != itEnd; it.increment(error))
+		{
+			if (it->is_regular_file(error))
+				vecFiles.push_back({ it->path().string() });
+		}
+
+		return true;
+	}
+
+	/// hash the single file, reading the small ones into the given reusable buffer
+	void HashFile(const Algorithm_t& algorithm, File_t& file, std::vector<std::uint8_t>& vecBuffer)
+	{
+	#ifdef Q_QHASH_POSIX
+		const int iFile = ::open(file.strPath.c_str(), O_RDONLY | O_CLOEXEC);
+		if (iFile < 0)
+		{
+			file.szError = "failed to open";
+			return;
+		}
+
+		struct stat fileStat;
+		if (::fstat(iFile, &fileStat) != 0)
+		{
+			::close(iFile);
+			file.szError = "failed to stat";
+			return;
+		}
+
+		file.ullSize = static_cast<std::uint64_t>(fileStat.st_size);
+		if (file.ullSize > std::numeric_limits<std::size_t>::max())
+			file.szError = "too large for the address space";
+		else if (file.ullSize >= ullMapThreshold)
+		{
+			void* pMapping = ::mmap(nullptr, static_cast<std::size_t>(file.ullSize), PROT_READ, MAP_PRIVATE, iFile, 0);
+			if (pMapping != MAP_FAILED)
+			{
+				// enlarges the read-ahead window, so the large files are streamed at the device speed
+				::madvise(pMapping, static_cast<std::size_t>(file.ullSize), MADV_SEQUENTIAL);
+				file.digest = algorithm.pfnHash(static_cast<const std::uint8_t*>(pMapping), static_cast<std::size_t>(file.ullSize));
+				::munmap(pMapping, static_cast<std::size_t>(file.ullSize));
+			}
+			else
+				file.szError = "failed to map";
+		}
+		else
+		{
+			vecBuffer.resize(static_cast<std::size_t>(file.ullSize));
+
+			std::size_t nRead = 0U;
+			while (nRead < vecBuffer.size())
+			{
+				const ssize_t nResult = ::pread(iFile, vecBuffer.data() + nRead, vecBuffer.size() - nRead, static_cast<off_t>(nRead));
+				if (nResult <= 0)
+					break;
+
+				nRead += static_cast<std::size_t>(nResult);
+			}
+
+			if (nRead == vecBuffer.size())
+				file.digest = algorithm.pfnHash(vecBuffer.data(), nRead);
+			else
+				file.szError = "failed to read";
+		}
+
+		::close(iFile);
+	#else
+		std::FILE* hFile = std::fopen(file.strPath.c_str(), "rb");
+		if (hFile == nullptr)
+		{
+			file.szError = "failed to open";
+			return;
+		}
+
+		std::error_code error;
+		file.ullSize = std::filesystem::file_size(file.strPath, error);
+		if (error)
+			file.szError = "failed to stat";
+		else if (file.ullSize > std::numeric_limits<std::size_t>::max())
+			file.szError = "too large for the address space";
+		else
+		{
+			vecBuffer.resize(static_cast<std::size_t>(file.ullSize));
+
+			if (std::fread(vecBuffer.data(), 1U, vecBuffer.size(), hFile) == vecBuffer.size())
+				file.digest = algorithm.pfnHash(vecBuffer.data(), vecBuffer.size());
+			else
+				file.szError = "failed to read";
+		}
+
+		std::fclose(hFile);
+	#endif
+	}
+
+	/// hash all files by the pool of threads, taking the largest files first so the pool doesn't wait for a single late one
+	void HashFiles(const Algorithm_t& algorithm, std::vector<File_t>& vecFiles, const unsigned int nThreadCount)
+	{
+		std::vector<std::size_t> vecOrder(vecFiles.size());
+		for (std::size_t i = 0U; i < vecOrder.size(); ++i)
+			vecOrder[i] = i;
+
+		std::error_code error;
+		for (File_t& file : vecFiles)
+			file.ullSize = std::filesystem::file_size(file.strPath, error);
+
+		std::sort(vecOrder.begin(), vecOrder.end(), [&vecFiles](const std::size_t nFirst, const std::size_t nSecond) { return vecFiles[nFirst].ullSize > vecFiles[nSecond].ullSize; });
+
+		std::atomic<std::size_t> nNextFile = 0U;
+		const auto Worker = [&]()
+		{
+			std::vector<std::uint8_t> vecBuffer;
+			for (std::size_t i; (i = nNextFile.fetch_add(1U, std::memory_order_relaxed)) < vecOrder.size();)
+				HashFile(algorithm, vecFiles[vecOrder[i]], vecBuffer);
+		};
+
+		std::vector<std::thread> vecThreads;
+		for (unsigned int i = 1U; i < nThreadCount; ++i)
+			vecThreads.emplace_back(Worker);
+
+		Worker();
+
+		for (std::thread& thread : vecThreads)
+			thread.join();
+	}
+
+	/* @section: options */
+	struct Options_t
+	{
+		const char* szAlgorithm = "crc32";
+		unsigned int nThreadCount = 0U;
+		std::vector<const char*> vecPaths;
+	};
+
+	bool ParseOptions(const int nArguments, char** arrArguments, Options_t& options)
+	{
+		for (int i = 1; i < nArguments; ++i)
+		{
+			const char* szOption = arrArguments[i];
+			if (std::strncmp(szOption, "--", 2U) != 0)
+			{
+				options.vecPaths.push_back(szOption);
+				continue;
+			}
+
+			if (i + 1 >= nArguments)
+				return false;
+
+			const char* szValue = arrArguments[++i];
+			if (std::strcmp(szOption, "--algo") == 0)
+				options.szAlgorithm = szValue;
+			else if (std::strcmp(szOption, "--threads") == 0)
+				options.nThreadCount = static_cast<unsigned int>(std::strtoul(szValue, nullptr, 10));
+			else
+				return false;
+		}
+
+		if (options.nThreadCount == 0U)
+			options.nThreadCount = std::max(std::thread::hardware_concurrency(), 1U);
+
+		return !options.vecPaths.empty();
+	}
+}
+
+int main(int nArguments, char** arrArguments)
+{
+	using namespace QHASH;
+
+	Options_t options;
+	if (!ParseOptions(nArguments, arrArguments, options))
+	{
+		std::fprintf(stderr, "usage: %s [--algo <name>] [--threads <count>] <path>...\nalgorithms:", arrArguments[0]);
+		for (const Algorithm_t& algorithm : arrAlgorithms)
+			std::fprintf(stderr, " %s", algorithm.szName);
+
+		std::fprintf(stderr, "\n");
+		return 1;
+	}
+
+	const Algorithm_t* pAlgorithm = nullptr;
+	for (const Algorithm_t& algorithm : arrAlgorithms)
+	{
+		if (std::strcmp(algorithm.szName, options.szAlgorithm) == 0)
+			pAlgorithm = &algorithm;
+	}
+
+	if (pAlgorithm == nullptr)
+	{
+		std::fprintf(stderr, "unknown algorithm '%s'\n", options.szAlgorithm);
+		return 1;
+	}
+
+	int iExitCode = 0;
+	std::vector<File_t> vecFiles;
+	for (const char* szPath : options.vecPaths)
+	{
+		if (!CollectFiles(szPath, vecFiles))
+		{
+			std::fprintf(stderr, "%s: no such file or directory\n", szPath);
+			iExitCode = 1;
+		}
+	}
+
+	std::sort(vecFiles.begin(), vecFiles.end(), [](const File_t& first, const File_t& second) { return first.strPath < second.strPath; });
+
+	const unsigned int nThreadCount = static_cast<unsigned int>(std::min<std::size_t>(options.nThreadCount, std::max<std::size_t>(vecFiles.size(), 1U)));
+
+	const auto timeStart = std::chrono::steady_clock::now();
+	HashFiles(*pAlgorithm, vecFiles, nThreadCount);
+	const double flSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - timeStart).count();
+
+	std::uint64_t ullTotalSize = 0U;
+	for (const File_t& file : vecFiles)
+	{
+		if (file.szError != nullptr)
+		{
+			std::fprintf(stderr, "%s: %s\n", file.strPath.c_str(), file.szError);
+			iExitCode = 1;
+			continue;
+		}
+
+		ullTotalSize += file.ullSize;
+
+		if (pAlgorithm->nBits > 64)
+			std::printf("%016llx%016llx  %s\n", static_cast<unsigned long long>(file.digest.ullLow), static_cast<unsigned long long>(file.digest.ullHigh), file.strPath.c_str());
+		else
+			std::printf("%0*llx  %s\n", pAlgorithm->nBits / 4, static_cast<unsigned long long>(file.digest.ullLow), file.strPath.c_str());
+	}
+
+	std::fprintf(stderr, "%zu files, %.2f MiB in %.3f s, %.2f GB/s with %u threads\n", vecFiles.size(), static_cast<double>(ullTotalSize) / (1024.0 * 1024.0), flSeconds, flSeconds > 0.0 ? static_cast<double>(ullTotalSize) / flSeconds * 1e-9 : 0.0, nThreadCount);
+	return iExitCode;
+}
@@ -0,0 +1,167 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint64_t
+#include <cstdint>
+// used: [stl] array
+#include <array>
+// used: [stl] rotl
+#include <bit>
+
+#ifndef Q_HASH_RABIN_KARP_BASE
+// multiplier of the polynomial, odd with the bits spread over the whole word so each byte reaches the high bits on its first step
+#define Q_HASH_RABIN_KARP_BASE 0x9E3779B97F4A7C15
+#endif
+
+#define Q_HASH_ROLLING
+
+/*
+ * ROLLING HASHES OF THE SLIDING WINDOW
+ * @note: each hash is updated in constant time when the window moves by one byte, by either appending the byte to the growing window or replacing the oldest byte, so the content-defined boundaries can be searched at the memory speed
+ * the high bits are mixed the best in all of them, so they should be tested for the boundaries
+ */
+namespace Q_HASH::ROLLING
+{
+	namespace DETAIL
+	{
+		/// @returns: lookup table of the pseudo-random values, generated by the splitmix64 sequence from given seed
+		consteval std::array<std::uint64_t, 256U> MakeRandomLookup(std::uint64_t ullSeed)
+		{
+			std::array<std::uint64_t, 256U> arrLookup = { };
+			for (std::uint64_t& ullEntry : arrLookup)
+			{
+				ullSeed += 0x9E3779B97F4A7C15;
+				std::uint64_t ullValue = ullSeed;
+				ullValue = (ullValue ^ (ullValue >> 30U)) * 0xBF58476D1CE4E5B9;
+				ullValue = (ullValue ^ (ullValue >> 27U)) * 0x94D049BB133111EB;
+				ullEntry = ullValue ^ (ullValue >> 31U);
+			}
+			return arrLookup;
+		}
+
+		consteval std::uint64_t Power(const std::uint64_t ullBase, std::size_t nExponent)
+		{
+			std::uint64_t ullResult = 1U;
+			while (nExponent-- > 0U)
+				ullResult *= ullBase;
+			return ullResult;
+		}
+
+		inline constexpr std::array<std::uint64_t, 256U> arrBuzHashLookup = MakeRandomLookup(0x42757A48617368);
+		inline constexpr std::array<std::uint64_t, 256U> arrGearLookup = MakeRandomLookup(0x4765617248617368);
+	}
+
+	/// polynomial hash of the window, computed with the same multiply-add step as in DJB2/FNV, where the oldest byte is subtracted by its precomputed weight
+	/// @credits: Richard M. Karp, Michael O. Rabin
+	template <std::size_t WINDOW = 64U>
+	class CRabinKarp
+	{
+	public:
+		static_assert(WINDOW > 0U, "window of the rolling hash must be non-empty");
+		static constexpr std::size_t nWindow = WINDOW;
+
+		/// clear the window
+		constexpr void Reset() noexcept
+		{
+			ullHash = 0U;
+		}
+
+		/// @param[in] uIn byte to append to the window that isn't full yet
+		constexpr void Append(const std::uint8_t uIn) noexcept
+		{
+			ullHash = ullHash * Q_HASH_RABIN_KARP_BASE + uIn;
+		}
+
+		/// @param[in] uOut oldest byte that leaves the full window
+		/// @param[in] uIn byte that enters the window
+		constexpr void Roll(const std::uint8_t uOut, const std::uint8_t uIn) noexcept
+		{
+			ullHash = ullHash * Q_HASH_RABIN_KARP_BASE + uIn - uOut * ullOutWeight;
+		}
+
+		/// @returns: hash of the bytes in the window
+		[[nodiscard]] constexpr std::uint64_t Get() const noexcept
+		{
+			return ullHash;
+		}
+
+	private:
+		// weight of the oldest byte after the multiplication of the current step
+		static constexpr std::uint64_t ullOutWeight = DETAIL::Power(Q_HASH_RABIN_KARP_BASE, WINDOW);
+		std::uint64_t ullHash = 0U;
+	};
+
+	/// cyclic polynomial hash of the window, where each byte is substituted by the random value and the oldest one is removed by the xor with its value rotated by the window length
+	/// @credits: Jonathan D. Cohen - Recursive Hashing Functions for n-Grams
+	template <std::size_t WINDOW = 64U>
+	class CBuzHash
+	{
+	public:
+		static_assert(WINDOW > 0U, "window of the rolling hash must be non-empty");
+		static constexpr std::size_t nWindow = WINDOW;
+
+		/// clear the window
+		constexpr void Reset() noexcept
+		{
+			ullHash = 0U;
+		}
+
+		/// @param[in] uIn byte to append to the window that isn't full yet
+		constexpr void Append(const std::uint8_t uIn) noexcept
+		{
+			ullHash = std::rotl(ullHash, 1) ^ DETAIL::arrBuzHashLookup[uIn];
+		}
+
+		/// @param[in] uOut oldest byte that leaves the full window
+		/// @param[in] uIn byte that enters the window
+		constexpr void Roll(const std::uint8_t uOut, const std::uint8_t uIn) noexcept
+		{
+			ullHash = std::rotl(ullHash, 1) ^ DETAIL::arrBuzHashLookup[uIn] ^ std::rotl(DETAIL::arrBuzHashLookup[uOut], static_cast<int>(WINDOW % 64U));
+		}
+
+		/// @returns: hash of the bytes in the window
+		[[nodiscard]] constexpr std::uint64_t Get() const noexcept
+		{
+			return ullHash;
+		}
+
+	private:
+		std::uint64_t ullHash = 0U;
+	};
+
+	/// hash of the implicit 64-byte window, where each byte is substituted by the random value and the oldest one is shifted out of the word, so the removed byte isn't needed at all
+	/// @credits: Wen Xia, Yukun Zhou, Hong Jiang et al. - FastCDC
+	class CGear
+	{
+	public:
+		// the oldest byte that still affects the highest bit
+		static constexpr std::size_t nWindow = 64U;
+
+		/// clear the window
+		constexpr void Reset() noexcept
+		{
+			ullHash = 0U;
+		}
+
+		/// @param[in] uIn byte to append to the window
+		constexpr void Append(const std::uint8_t uIn) noexcept
+		{
+			ullHash = (ullHash << 1U) + DETAIL::arrGearLookup[uIn];
+		}
+
+		/// @param[in] uIn byte that enters the window, the oldest one leaves it implicitly
+		constexpr void Roll(const std::uint8_t, const std::uint8_t uIn) noexcept
+		{
+			Append(uIn);
+		}
+
+		/// @returns: hash of the last bytes
+		[[nodiscard]] constexpr std::uint64_t Get() const noexcept
+		{
+			return ullHash;
+		}
+
+	private:
+		std::uint64_t ullHash = 0U;
+	};
+}
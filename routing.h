@@ -0,0 +1,537 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint32_t, uint64_t, int64_t
+#include <cstdint>
+// used: [stl] lower_bound, sort, fill_n, all_of
+#include <algorithm>
+// used: [stl] log
+#include <cmath>
+// used: [stl] is_integral_v
+#include <type_traits>
+// used: [stl] pair
+#include <utility>
+// used: [stl] vector
+#include <vector>
+
+// used: Q_HASH_CPU_X86, Q_HASH_TARGET, hasfeatures, cdispatch, prefetch
+#include "simd.h"
+
+#if !defined(Q_HASH_ROUTING_NO_AVX2) && defined(Q_HASH_CPU_X86)
+#define Q_HASH_ROUTING_AVX2
+#endif
+
+#define Q_HASH_ROUTING
+
+/*
+ * CONSISTENT ROUTING OF THE HASHED KEYS TO THE SHARDS
+ * @note: keys that were already hashed by any algorithm are mixed once more, so even the 32-bit or non-avalanching hashes are spread over the whole 64-bit range, then on the change of the shard count only the keys of the added or removed shards move, unlike with the modulo of the hash
+ */
+namespace Q_HASH::ROUTING
+{
+	// node that is routed to when there are no nodes at all
+	inline constexpr std::uint64_t ullInvalidNode = ~0ULL;
+
+	namespace DETAIL
+	{
+		// count of the keys which binary searches over the ring advance together, so their cache misses overlap
+		inline constexpr std::size_t nRingBatchWindow = 8U;
+		// count of the weighted nodes which scores are kept on the stack instead of the heap
+		inline constexpr std::size_t nRendezvousStackNodeCount = 64U;
+
+		/// force all bits of the key to avalanche
+		constexpr std::uint64_t Mix(std::uint64_t ullKey) noexcept
+		{
+			ullKey ^= ullKey >> 33U;
+			ullKey *= 0xFF51AFD7ED558CCD;
+			ullKey ^= ullKey >> 33U;
+			ullKey *= 0xC4CEB9FE1A85EC53;
+			ullKey ^= ullKey >> 33U;
+			return ullKey;
+		}
+
+		/// @returns: hash of any supported width, reduced to the 64-bit routing key with all bits avalanched
+		template <typename THash>
+		constexpr std::uint64_t MakeKey(const THash& hash) noexcept
+		{
+			if constexpr (std::is_integral_v<THash>)
+				return Mix(static_cast<std::uint64_t>(hash));
+			else
+				return Mix(hash.ullLow);
+		}
+
+		/* @section: rendezvous */
+		/// @returns: index of the first node with the highest score of the key, where the score is the key mixed with the node seed
+		inline std::size_t RendezvousSelectScalar(const std::uint64_t ullKey, const std::uint64_t* pSeeds, const std::size_t nNodeCount) noexcept
+		{
+			std::size_t nBest = 0U;
+			std::uint64_t ullBestScore = Mix(ullKey ^ pSeeds[0]);
+
+			for (std::size_t i = 1U; i < nNodeCount; ++i)
+			{
+				if (const std::uint64_t ullScore = Mix(ullKey ^ pSeeds[i]); ullScore > ullBestScore)
+				{
+					ullBestScore = ullScore;
+					nBest = i;
+				}
+			}
+
+			return nBest;
+		}
+
+		/// @param[out] pScores array that receives the key mixed with each node seed
+		inline void RendezvousScoreScalar(const std::uint64_t ullKey, const std::uint64_t* pSeeds, const std::size_t nNodeCount, std::uint64_t* pScores) noexcept
+		{
+			for (std::size_t i = 0U; i < nNodeCount; ++i)
+				pScores[i] = Mix(ullKey ^ pSeeds[i]);
+		}
+
+	#ifdef Q_HASH_ROUTING_AVX2
+		/// @returns: low 64 bits of the product of each lane with the constant, AVX2 has only the 32-bit multiplication
+		Q_HASH_TARGET("avx2") inline __m256i Multiply64(const __m256i ymmValue, const std::uint64_t ullFactor) noexcept
+		{
+			const __m256i ymmFactorLow = _mm256_set1_epi64x(static_cast<long long>(ullFactor & 0xFFFFFFFF));
+			const __m256i ymmFactorHigh = _mm256_set1_epi64x(static_cast<long long>(ullFactor >> 32U));
+			const __m256i ymmCross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(ymmValue, 32), ymmFactorLow), _mm256_mul_epu32(ymmValue, ymmFactorHigh));
+			return _mm256_add_epi64(_mm256_mul_epu32(ymmValue, ymmFactorLow), _mm256_slli_epi64(ymmCross, 32));
+		}
+
+		Q_HASH_TARGET("avx2") inline __m256i MixAVX2(__m256i ymmKey) noexcept
+		{
+			ymmKey = _mm256_xor_si256(ymmKey, _mm256_srli_epi64(ymmKey, 33));
+			ymmKey = Multiply64(ymmKey, 0xFF51AFD7ED558CCD);
+			ymmKey = _mm256_xor_si256(ymmKey, _mm256_srli_epi64(ymmKey, 33));
+			ymmKey = Multiply64(ymmKey, 0xC4CEB9FE1A85EC53);
+			return _mm256_xor_si256(ymmKey, _mm256_srli_epi64(ymmKey, 33));
+		}
+
+		Q_HASH_TARGET("avx2") inline std::size_t RendezvousSelectAVX2(const std::uint64_t ullKey, const std::uint64_t* pSeeds, const std::size_t nNodeCount) noexcept
+		{
+			const std::size_t nVectorNodeCount = nNodeCount & ~static_cast<std::size_t>(3U);
+			if (nVectorNodeCount == 0U)
+				return RendezvousSelectScalar(ullKey, pSeeds, nNodeCount);
+
+			// AVX2 compares only the signed 64-bit lanes, so the scores are biased by the sign bit
+			const __m256i ymmSignBit = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000));
+			const __m256i ymmKey = _mm256_set1_epi64x(static_cast<long long>(ullKey));
+			const __m256i ymmStep = _mm256_set1_epi64x(4);
+
+			// each lane keeps its first best node, as the scalar selection does
+			__m256i ymmBestScores = _mm256_xor_si256(MixAVX2(_mm256_xor_si256(ymmKey, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSeeds)))), ymmSignBit);
+			__m256i ymmBestIndices = _mm256_setr_epi64x(0, 1, 2, 3);
+			__m256i ymmIndices = ymmBestIndices;
+
+			for (std::size_t i = 4U; i < nVectorNodeCount; i += 4U)
+			{
+				ymmIndices = _mm256_add_epi64(ymmIndices, ymmStep);
+
+				const __m256i ymmScores = _mm256_xor_si256(MixAVX2(_mm256_xor_si256(ymmKey, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSeeds + i)))), ymmSignBit);
+				const __m256i ymmGreater = _mm256_cmpgt_epi64(ymmScores, ymmBestScores);
+				ymmBestScores = _mm256_blendv_epi8(ymmBestScores, ymmScores, ymmGreater);
+				ymmBestIndices = _mm256_blendv_epi8(ymmBestIndices, ymmIndices, ymmGreater);
+			}
+
+			alignas(32) std::uint64_t arrScores[4], arrIndices[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(arrScores), _mm256_xor_si256(ymmBestScores, ymmSignBit));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(arrIndices), ymmBestIndices);
+
+			// reduce the lanes, the ties go to the lower index
+			std::size_t nBest = static_cast<std::size_t>(arrIndices[0]);
+			std::uint64_t ullBestScore = arrScores[0];
+			for (std::size_t i = 1U; i < 4U; ++i)
+			{
+				if (arrScores[i] > ullBestScore || (arrScores[i] == ullBestScore && arrIndices[i] < nBest))
+				{
+					ullBestScore = arrScores[i];
+					nBest = static_cast<std::size_t>(arrIndices[i]);
+				}
+			}
+
+			// remaining nodes have the higher indices, so they replace the best only by the greater score
+			for (std::size_t i = nVectorNodeCount; i < nNodeCount; ++i)
+			{
+				if (const std::uint64_t ullScore = Mix(ullKey ^ pSeeds[i]); ullScore > ullBestScore)
+				{
+					ullBestScore = ullScore;
+					nBest = i;
+				}
+			}
+
+			return nBest;
+		}
+
+		Q_HASH_TARGET("avx2") inline void RendezvousScoreAVX2(const std::uint64_t ullKey, const std::uint64_t* pSeeds, const std::size_t nNodeCount, std::uint64_t* pScores) noexcept
+		{
+			const __m256i ymmKey = _mm256_set1_epi64x(static_cast<long long>(ullKey));
+
+			std::size_t i = 0U;
+			for (; i + 4U <= nNodeCount; i += 4U)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pScores + i), MixAVX2(_mm256_xor_si256(ymmKey, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSeeds + i)))));
+
+			RendezvousScoreScalar(ullKey, pSeeds + i, nNodeCount - i, pScores + i);
+		}
+	#endif
+
+		/// select the node of each key when all nodes have the same weight, then the highest score wins
+		template <auto pfnSelect>
+		void RendezvousSelectBatch(const std::uint64_t* pKeys, const std::size_t nCount, const std::uint64_t* pSeeds, const std::uint64_t* pNodes, const std::size_t nNodeCount, std::uint64_t* pResults) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				pResults[i] = pNodes[pfnSelect(pKeys[i], pSeeds, nNodeCount)];
+		}
+
+		/// select the node of each key by the score scaled by the weight of the node
+		/// @param[in] pScratch buffer of at least the node count of scores
+		template <auto pfnScore>
+		void RendezvousWeightedBatch(const std::uint64_t* pKeys, const std::size_t nCount, const std::uint64_t* pSeeds, const double* pInverseWeights, const std::uint64_t* pNodes, const std::size_t nNodeCount, std::uint64_t* pScratch, std::uint64_t* pResults) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+			{
+				pfnScore(pKeys[i], pSeeds, nNodeCount, pScratch);
+
+				// the uniform score in (0, 1] is turned into the exponential one, so each node wins with the probability proportional to its weight
+				std::size_t nBest = 0U;
+				double flBestScore = -HUGE_VAL;
+				for (std::size_t j = 0U; j < nNodeCount; ++j)
+				{
+					const double flUniform = static_cast<double>((pScratch[j] >> 11U) + 1U) * 0x1.0p-53;
+					if (const double flScore = std::log(flUniform) * pInverseWeights[j]; flScore > flBestScore)
+					{
+						flBestScore = flScore;
+						nBest = j;
+					}
+				}
+
+				pResults[i] = pNodes[nBest];
+			}
+		}
+
+		/* @section: dispatch */
+		using RendezvousSelect_t = void(const std::uint64_t*, std::size_t, const std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t*) noexcept;
+		using RendezvousWeighted_t = void(const std::uint64_t*, std::size_t, const std::uint64_t*, const double*, const std::uint64_t*, std::size_t, std::uint64_t*, std::uint64_t*) noexcept;
+
+	#ifdef Q_HASH_ROUTING_AVX2
+		inline RendezvousSelect_t* ResolveRendezvousSelect() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &RendezvousSelectBatch<&RendezvousSelectAVX2>;
+
+			return &RendezvousSelectBatch<&RendezvousSelectScalar>;
+		}
+
+		inline RendezvousWeighted_t* ResolveRendezvousWeighted() noexcept
+		{
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &RendezvousWeightedBatch<&RendezvousScoreAVX2>;
+
+			return &RendezvousWeightedBatch<&RendezvousScoreScalar>;
+		}
+
+		using RendezvousSelectDispatch_t = Q_HASH::CPU::CDispatch<RendezvousSelect_t, &ResolveRendezvousSelect>;
+		using RendezvousWeightedDispatch_t = Q_HASH::CPU::CDispatch<RendezvousWeighted_t, &ResolveRendezvousWeighted>;
+	#endif
+	}
+
+	/// @param[in] ullKey well-mixed 64-bit key
+	/// @param[in] nBucketCount count of the buckets, must be non-zero
+	/// @returns: bucket of the key in range [0, nBucketCount), that changes only for about '1 / nBucketCount' keys when one bucket is added to the end
+	/// @credits: John Lamping, Eric Veach - A Fast, Minimal Memory, Consistent Hash Algorithm
+	constexpr std::uint32_t JumpHash(std::uint64_t ullKey, const std::uint32_t nBucketCount) noexcept
+	{
+		std::int64_t iBucket = -1, iNextBucket = 0;
+
+		// each step jumps over the buckets the key would stay out of, so it takes about the logarithm of the count of steps
+		while (iNextBucket < static_cast<std::int64_t>(nBucketCount))
+		{
+			iBucket = iNextBucket;
+			ullKey = ullKey * 2862933555777941757ULL + 1U;
+			iNextBucket = static_cast<std::int64_t>(static_cast<double>(iBucket + 1) * (static_cast<double>(1LL << 31) / static_cast<double>((ullKey >> 33U) + 1U)));
+		}
+
+		return static_cast<std::uint32_t>(iBucket);
+	}
+
+	/// router to the numbered buckets, that may be added or removed only at the end, but takes no memory
+	class CJump
+	{
+	public:
+		/// @param[in] nBucketCount count of the buckets, must be non-zero
+		explicit constexpr CJump(const std::uint32_t nBucketCount) noexcept :
+			nBucketCount(nBucketCount) { }
+
+		/// @param[in] hash hash of the key by any algorithm
+		/// @returns: bucket of the key in range [0, bucket count)
+		template <typename THash>
+		[[nodiscard]] constexpr std::uint32_t Route(const THash& hash) const noexcept
+		{
+			return JumpHash(DETAIL::MakeKey(hash), nBucketCount);
+		}
+
+		/// @param[in] pHashes array of the hashes of the keys by any algorithm
+		/// @param[in] nCount count of the keys
+		/// @param[out] pResults array that receives bucket of each key
+		template <typename THash>
+		void Route(const THash* pHashes, const std::size_t nCount, std::uint32_t* pResults) const noexcept
+		{
+			// steps of the keys are independent, so the loop is bound by the division throughput rather than its latency
+			for (std::size_t i = 0U; i < nCount; ++i)
+				pResults[i] = Route(pHashes[i]);
+		}
+
+		[[nodiscard]] constexpr std::uint32_t GetBucketCount() const noexcept
+		{
+			return nBucketCount;
+		}
+
+	private:
+		std::uint32_t nBucketCount;
+	};
+
+	/// highest random weight router to the arbitrary set of the weighted nodes, that moves only the keys of the changed node, at the cost of scoring all nodes per key
+	/// @credits: David G. Thaler, Chinya V. Ravishankar - Using Name-Based Mappings to Increase Hit Rates; Jason Resch - New Hashing Algorithms for Data Storage
+	class CRendezvous
+	{
+	public:
+		/* @section: get */
+		[[nodiscard]] std::size_t GetNodeCount() const noexcept
+		{
+			return vecNodes.size();
+		}
+
+		/// @param[in] hash hash of the key by any algorithm
+		/// @returns: identifier of the node of the key, or 'ullInvalidNode' if there are no nodes
+		template <typename THash>
+		[[nodiscard]] std::uint64_t Route(const THash& hash) const
+		{
+			std::uint64_t ullResult;
+			Route(&hash, 1U, &ullResult);
+			return ullResult;
+		}
+
+		/// @param[in] pHashes array of the hashes of the keys by any algorithm
+		/// @param[in] nCount count of the keys
+		/// @param[out] pResults array that receives identifier of the node of each key, or 'ullInvalidNode' if there are no nodes
+		template <typename THash>
+		void Route(const THash* pHashes, const std::size_t nCount, std::uint64_t* pResults) const
+		{
+			if (vecNodes.empty())
+			{
+				std::fill_n(pResults, nCount, ullInvalidNode);
+				return;
+			}
+
+			// keys are mixed in-place of the results, then replaced by the nodes
+			for (std::size_t i = 0U; i < nCount; ++i)
+				pResults[i] = DETAIL::MakeKey(pHashes[i]);
+
+			if (bUniformWeights)
+			{
+			#ifdef Q_HASH_ROUTING_AVX2
+				DETAIL::RendezvousSelectDispatch_t::Call(pResults, nCount, vecSeeds.data(), vecNodes.data(), vecNodes.size(), pResults);
+			#else
+				DETAIL::RendezvousSelectBatch<&DETAIL::RendezvousSelectScalar>(pResults, nCount, vecSeeds.data(), vecNodes.data(), vecNodes.size(), pResults);
+			#endif
+			}
+			else
+			{
+				// scores of the usual count of nodes fit the stack
+				std::uint64_t arrScratch[DETAIL::nRendezvousStackNodeCount];
+				std::vector<std::uint64_t> vecScratch;
+				std::uint64_t* pScratch = arrScratch;
+
+				if (vecNodes.size() > DETAIL::nRendezvousStackNodeCount)
+				{
+					vecScratch.resize(vecNodes.size());
+					pScratch = vecScratch.data();
+				}
+
+			#ifdef Q_HASH_ROUTING_AVX2
+				DETAIL::RendezvousWeightedDispatch_t::Call(pResults, nCount, vecSeeds.data(), vecInverseWeights.data(), vecNodes.data(), vecNodes.size(), pScratch, pResults);
+			#else
+				DETAIL::RendezvousWeightedBatch<&DETAIL::RendezvousScoreScalar>(pResults, nCount, vecSeeds.data(), vecInverseWeights.data(), vecNodes.data(), vecNodes.size(), pScratch, pResults);
+			#endif
+			}
+		}
+
+		/* @section: set */
+		/// @param[in] ullNode identifier of the node, that must be unique and stable between the routers that should agree, e.g. hash of its address
+		/// @param[in] flWeight positive share of the keys relative to the other nodes
+		void AddNode(const std::uint64_t ullNode, const double flWeight = 1.0)
+		{
+			vecNodes.push_back(ullNode);
+			vecSeeds.push_back(DETAIL::Mix(ullNode));
+			vecWeights.push_back(flWeight);
+			vecInverseWeights.push_back(1.0 / flWeight);
+			UpdateUniformWeights();
+		}
+
+		/// @returns: true if the node has been removed, false if it wasn't added
+		bool RemoveNode(const std::uint64_t ullNode)
+		{
+			for (std::size_t i = 0U; i < vecNodes.size(); ++i)
+			{
+				if (vecNodes[i] != ullNode)
+					continue;
+
+				vecNodes.erase(vecNodes.begin() + static_cast<std::ptrdiff_t>(i));
+				vecSeeds.erase(vecSeeds.begin() + static_cast<std::ptrdiff_t>(i));
+				vecWeights.erase(vecWeights.begin() + static_cast<std::ptrdiff_t>(i));
+				vecInverseWeights.erase(vecInverseWeights.begin() + static_cast<std::ptrdiff_t>(i));
+				UpdateUniformWeights();
+				return true;
+			}
+
+			return false;
+		}
+
+	private:
+		void UpdateUniformWeights() noexcept
+		{
+			// equal weights don't change the order of the scores, so the winner is found without the logarithms
+			bUniformWeights = std::all_of(vecWeights.begin(), vecWeights.end(), [this](const double flWeight) { return flWeight == vecWeights[0]; });
+		}
+
+		std::vector<std::uint64_t> vecNodes = { };
+		std::vector<std::uint64_t> vecSeeds = { };
+		std::vector<double> vecWeights = { };
+		std::vector<double> vecInverseWeights = { };
+		bool bUniformWeights = true;
+	};
+
+	/// router to the arbitrary set of the nodes placed at the many points of the 64-bit ring, where the key goes to the node of the first point at or after it
+	/// @credits: David Karger, Eric Lehman, Tom Leighton et al. - Consistent Hashing and Random Trees
+	class CRing
+	{
+	public:
+		/// @param[in] nPointsPerWeight count of the points of the node per unit of its weight, more points spread the keys more evenly at the cost of memory
+		explicit CRing(const std::uint32_t nPointsPerWeight = 160U) :
+			nPointsPerWeight(nPointsPerWeight) { }
+
+		/* @section: get */
+		/// @returns: count of the points of all nodes
+		[[nodiscard]] std::size_t GetPointCount() const noexcept
+		{
+			return vecPositions.size();
+		}
+
+		/// @param[in] hash hash of the key by any algorithm
+		/// @returns: identifier of the node of the key, or 'ullInvalidNode' if there are no nodes
+		template <typename THash>
+		[[nodiscard]] std::uint64_t Route(const THash& hash) const noexcept
+		{
+			if (vecPositions.empty())
+				return ullInvalidNode;
+
+			const auto itPoint = std::lower_bound(vecPositions.begin(), vecPositions.end(), DETAIL::MakeKey(hash));
+			return vecPointNodes[(itPoint != vecPositions.end()) ? static_cast<std::size_t>(itPoint - vecPositions.begin()) : 0U];
+		}
+
+		/// @param[in] pHashes array of the hashes of the keys by any algorithm
+		/// @param[in] nCount count of the keys
+		/// @param[out] pResults array that receives identifier of the node of each key, or 'ullInvalidNode' if there are no nodes
+		template <typename THash>
+		void Route(const THash* pHashes, const std::size_t nCount, std::uint64_t* pResults) const noexcept
+		{
+			if (vecPositions.empty())
+			{
+				std::fill_n(pResults, nCount, ullInvalidNode);
+				return;
+			}
+
+			const std::uint64_t* pPositions = vecPositions.data();
+			std::uint64_t arrKeys[DETAIL::nRingBatchWindow];
+			std::size_t arrBases[DETAIL::nRingBatchWindow];
+
+			for (std::size_t nOffset = 0U; nOffset < nCount; nOffset += DETAIL::nRingBatchWindow)
+			{
+				const std::size_t nWindow = (nCount - nOffset < DETAIL::nRingBatchWindow) ? nCount - nOffset : DETAIL::nRingBatchWindow;
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+				{
+					arrKeys[i] = DETAIL::MakeKey(pHashes[nOffset + i]);
+					arrBases[i] = 0U;
+				}
+
+				// branchless search of the first point at or after the key, all keys of the window halve their ranges together and request their next probes ahead
+				for (std::size_t nLength = vecPositions.size(); nLength > 1U;)
+				{
+					const std::size_t nHalf = nLength / 2U;
+					nLength -= nHalf;
+
+					for (std::size_t i = 0U; i < nWindow; ++i)
+					{
+						arrBases[i] = (pPositions[arrBases[i] + nHalf] < arrKeys[i]) ? arrBases[i] + nHalf : arrBases[i];
+						SIMD::Prefetch(pPositions + arrBases[i] + nLength / 2U);
+					}
+				}
+
+				for (std::size_t i = 0U; i < nWindow; ++i)
+				{
+					// either the found point is at or after the key, or the key is past all points and wraps around to the first one
+					std::size_t nPoint = arrBases[i] + static_cast<std::size_t>(pPositions[arrBases[i]] < arrKeys[i]);
+					if (nPoint == vecPositions.size())
+						nPoint = 0U;
+
+					pResults[nOffset + i] = vecPointNodes[nPoint];
+				}
+			}
+		}
+
+		/* @section: set */
+		/// @param[in] ullNode identifier of the node, that must be unique and stable between the routers that should agree, e.g. hash of its address
+		/// @param[in] nWeight share of the keys relative to the other nodes, as the multiplier of the count of its points
+		void AddNode(const std::uint64_t ullNode, const std::uint32_t nWeight = 1U)
+		{
+			std::vector<std::pair<std::uint64_t, std::uint64_t>> vecPoints;
+			vecPoints.reserve(vecPositions.size() + static_cast<std::size_t>(nPointsPerWeight) * nWeight);
+
+			for (std::size_t i = 0U; i < vecPositions.size(); ++i)
+				vecPoints.emplace_back(vecPositions[i], vecPointNodes[i]);
+
+			const std::uint64_t ullSeed = DETAIL::Mix(ullNode);
+			for (std::uint64_t i = 0U; i < static_cast<std::uint64_t>(nPointsPerWeight) * nWeight; ++i)
+				vecPoints.emplace_back(DETAIL::Mix(ullSeed + (i + 1U) * 0x9E3779B97F4A7C15), ullNode);
+
+			// the colliding points are ordered by the node, so the result doesn't depend on the order the nodes were added in
+			std::sort(vecPoints.begin(), vecPoints.end());
+			Assign(vecPoints);
+		}
+
+		/// @returns: true if the node has been removed, false if it wasn't added
+		bool RemoveNode(const std::uint64_t ullNode)
+		{
+			std::vector<std::pair<std::uint64_t, std::uint64_t>> vecPoints;
+			vecPoints.reserve(vecPositions.size());
+
+			for (std::size_t i = 0U; i < vecPositions.size(); ++i)
+			{
+				if (vecPointNodes[i] != ullNode)
+					vecPoints.emplace_back(vecPositions[i], vecPointNodes[i]);
+			}
+
+			if (vecPoints.size() == vecPositions.size())
+				return false;
+
+			Assign(vecPoints);
+			return true;
+		}
+
+	private:
+		void Assign(const std::vector<std::pair<std::uint64_t, std::uint64_t>>& vecPoints)
+		{
+			vecPositions.resize(vecPoints.size());
+			vecPointNodes.resize(vecPoints.size());
+
+			for (std::size_t i = 0U; i < vecPoints.size(); ++i)
+			{
+				vecPositions[i] = vecPoints[i].first;
+				vecPointNodes[i] = vecPoints[i].second;
+			}
+		}
+
+		std::uint32_t nPointsPerWeight;
+		// sorted positions of the points, searched separately from their nodes so the probes touch fewer cache lines
+		std::vector<std::uint64_t> vecPositions = { };
+		std::vector<std::uint64_t> vecPointNodes = { };
+	};
+}
@@ -0,0 +1,170 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uintptr_t
+#include <cstdint>
+// used: [stl] countr_zero
+#include <bit>
+// used: Q_HASH_CPU_X86, Q_HASH_CPU_X64, Q_HASH_TARGET
+#include "cpu.h"
+
+#ifdef Q_HASH_CPU_X86
+// used: [intrin] sse2, avx2, avx512
+#include <immintrin.h>
+
+#if !defined(Q_HASH_FORCE_SCALAR) && (defined(Q_HASH_CPU_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define Q_HASH_SIMD_SSE2
+#endif
+#endif
+
+// the string scanners read the whole aligned chunk of the terminator, which never crosses the page boundary, but is still reported as the overflow by the sanitizers, so they walk the strings by characters there
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_HWADDRESS__)
+#define Q_HASH_SIMD_SANITIZED
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(hwaddress_sanitizer) || __has_feature(memory_sanitizer)
+#define Q_HASH_SIMD_SANITIZED
+#endif
+#endif
+
+#if defined(Q_HASH_SIMD_SSE2) && !defined(Q_HASH_SIMD_SANITIZED)
+#define Q_HASH_SIMD_SCAN_STRING
+#endif
+
+#ifndef Q_HASH_SIMD_SCAN_STRING
+// used: [crt] strlen
+#include <cstring>
+#endif
+
+/*
+ * VECTOR HELPERS SHARED BY THE MULTI-BUFFER KERNELS
+ */
+namespace Q_HASH::SIMD
+{
+#ifdef Q_HASH_CPU_X86
+	/// transpose 8x8 matrix of 32-bit elements, so when each row holds consecutive blocks of the single buffer, each row becomes the same block of all the buffers
+	Q_HASH_TARGET("avx2") inline void Transpose(__m256i (&arrRows)[8]) noexcept
+	{
+		const __m256i ymmPairs0 = _mm256_unpacklo_epi32(arrRows[0], arrRows[1]), ymmPairs1 = _mm256_unpackhi_epi32(arrRows[0], arrRows[1]);
+		const __m256i ymmPairs2 = _mm256_unpacklo_epi32(arrRows[2], arrRows[3]), ymmPairs3 = _mm256_unpackhi_epi32(arrRows[2], arrRows[3]);
+		const __m256i ymmPairs4 = _mm256_unpacklo_epi32(arrRows[4], arrRows[5]), ymmPairs5 = _mm256_unpackhi_epi32(arrRows[4], arrRows[5]);
+		const __m256i ymmPairs6 = _mm256_unpacklo_epi32(arrRows[6], arrRows[7]), ymmPairs7 = _mm256_unpackhi_epi32(arrRows[6], arrRows[7]);
+
+		const __m256i ymmQuads0 = _mm256_unpacklo_epi64(ymmPairs0, ymmPairs2), ymmQuads1 = _mm256_unpackhi_epi64(ymmPairs0, ymmPairs2);
+		const __m256i ymmQuads2 = _mm256_unpacklo_epi64(ymmPairs1, ymmPairs3), ymmQuads3 = _mm256_unpackhi_epi64(ymmPairs1, ymmPairs3);
+		const __m256i ymmQuads4 = _mm256_unpacklo_epi64(ymmPairs4, ymmPairs6), ymmQuads5 = _mm256_unpackhi_epi64(ymmPairs4, ymmPairs6);
+		const __m256i ymmQuads6 = _mm256_unpacklo_epi64(ymmPairs5, ymmPairs7), ymmQuads7 = _mm256_unpackhi_epi64(ymmPairs5, ymmPairs7);
+
+		arrRows[0] = _mm256_permute2x128_si256(ymmQuads0, ymmQuads4, 0x20);
+		arrRows[1] = _mm256_permute2x128_si256(ymmQuads1, ymmQuads5, 0x20);
+		arrRows[2] = _mm256_permute2x128_si256(ymmQuads2, ymmQuads6, 0x20);
+		arrRows[3] = _mm256_permute2x128_si256(ymmQuads3, ymmQuads7, 0x20);
+		arrRows[4] = _mm256_permute2x128_si256(ymmQuads0, ymmQuads4, 0x31);
+		arrRows[5] = _mm256_permute2x128_si256(ymmQuads1, ymmQuads5, 0x31);
+		arrRows[6] = _mm256_permute2x128_si256(ymmQuads2, ymmQuads6, 0x31);
+		arrRows[7] = _mm256_permute2x128_si256(ymmQuads3, ymmQuads7, 0x31);
+	}
+
+	/// transpose 8x8 matrix of 64-bit elements, so when each row holds consecutive blocks of the single buffer, each row becomes the same block of all the buffers
+	Q_HASH_TARGET("avx512f") inline void Transpose(__m512i (&arrRows)[8]) noexcept
+	{
+		// zero-masked forms with all lanes selected, the unmasked ones of GCC 12 merge into the self-initialized undefined vector, which it then reports as used uninitialized
+		constexpr __mmask8 kAll = 0xFF;
+
+		const __m512i zmmPairs0 = _mm512_maskz_unpacklo_epi64(kAll, arrRows[0], arrRows[1]), zmmPairs1 = _mm512_maskz_unpackhi_epi64(kAll, arrRows[0], arrRows[1]);
+		const __m512i zmmPairs2 = _mm512_maskz_unpacklo_epi64(kAll, arrRows[2], arrRows[3]), zmmPairs3 = _mm512_maskz_unpackhi_epi64(kAll, arrRows[2], arrRows[3]);
+		const __m512i zmmPairs4 = _mm512_maskz_unpacklo_epi64(kAll, arrRows[4], arrRows[5]), zmmPairs5 = _mm512_maskz_unpackhi_epi64(kAll, arrRows[4], arrRows[5]);
+		const __m512i zmmPairs6 = _mm512_maskz_unpacklo_epi64(kAll, arrRows[6], arrRows[7]), zmmPairs7 = _mm512_maskz_unpackhi_epi64(kAll, arrRows[6], arrRows[7]);
+
+		// gather even and odd 128-bit lanes
+		const __m512i zmmQuads0 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs0, zmmPairs2, 0x88), zmmQuads1 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs0, zmmPairs2, 0xDD);
+		const __m512i zmmQuads2 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs1, zmmPairs3, 0x88), zmmQuads3 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs1, zmmPairs3, 0xDD);
+		const __m512i zmmQuads4 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs4, zmmPairs6, 0x88), zmmQuads5 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs4, zmmPairs6, 0xDD);
+		const __m512i zmmQuads6 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs5, zmmPairs7, 0x88), zmmQuads7 = _mm512_maskz_shuffle_i64x2(kAll, zmmPairs5, zmmPairs7, 0xDD);
+
+		arrRows[0] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads0, zmmQuads4, 0x88);
+		arrRows[1] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads2, zmmQuads6, 0x88);
+		arrRows[2] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads1, zmmQuads5, 0x88);
+		arrRows[3] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads3, zmmQuads7, 0x88);
+		arrRows[4] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads0, zmmQuads4, 0xDD);
+		arrRows[5] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads2, zmmQuads6, 0xDD);
+		arrRows[6] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads1, zmmQuads5, 0xDD);
+		arrRows[7] = _mm512_maskz_shuffle_i64x2(kAll, zmmQuads3, zmmQuads7, 0xDD);
+	}
+
+	/// @returns: remaining bytes of the buffer that don't form a whole block, without touching memory past the buffer
+	template <typename T>
+	inline T LoadTail(const std::uint8_t* pSource, const std::size_t nLength) noexcept
+	{
+		const std::size_t nTailLength = nLength & (sizeof(T) - 1U);
+
+		// take the last whole block shifted by the length of the body part
+		if (nLength >= sizeof(T))
+		{
+			const T uLastBlock = *reinterpret_cast<const T*>(pSource + nLength - sizeof(T));
+			return (nTailLength != 0U) ? uLastBlock >> ((sizeof(T) - nTailLength) * 8U) : 0U;
+		}
+
+		T uTail = 0U;
+		for (std::size_t i = 0U; i < nLength; ++i)
+			uTail |= static_cast<T>(pSource[i]) << (i * 8U);
+
+		return uTail;
+	}
+
+	/// load up to 8 32-bit blocks of the buffer, blocks past the end of the buffer are zeroed and never touched
+	/// @param[in] nRemainingBlocks count of the whole blocks left in the buffer, may be negative
+	Q_HASH_TARGET("avx2") inline __m256i LoadBlocks32(const std::uint8_t* pSource, const int nRemainingBlocks) noexcept
+	{
+		const __m256i ymmMask = _mm256_cmpgt_epi32(_mm256_set1_epi32(nRemainingBlocks), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		return _mm256_maskload_epi32(reinterpret_cast<const int*>(pSource), ymmMask);
+	}
+
+	/// load up to 8 64-bit blocks of the buffer, blocks past the end of the buffer are zeroed and never touched
+	/// @param[in] nRemainingBlocks count of the whole blocks left in the buffer, may be negative
+	Q_HASH_TARGET("avx512f") inline __m512i LoadBlocks64(const std::uint8_t* pSource, const int nRemainingBlocks) noexcept
+	{
+		const __mmask8 kMask = static_cast<__mmask8>(nRemainingBlocks >= 8 ? 0xFF : nRemainingBlocks > 0 ? (1U << nRemainingBlocks) - 1U : 0U);
+		return _mm512_maskz_loadu_epi64(kMask, pSource);
+	}
+#endif
+
+	/// request the cache line of given address ahead of its use, so the independent misses of the batched operations overlap
+	inline void Prefetch(const void* pAddress) noexcept
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(pAddress);
+	#elif defined(Q_HASH_CPU_X86)
+		_mm_prefetch(static_cast<const char*>(pAddress), _MM_HINT_T0);
+	#else
+		static_cast<void>(pAddress);
+	#endif
+	}
+
+	/// walk the null-terminated string once, by the aligned 16-byte chunks that never cross the page boundary, so the string is read only up to the chunk of its terminator
+	/// @param[in] fnSpan callable as 'fnSpan(pSpanEnd)' with the end of each span of the string known to precede the terminator, the last call is with the terminator itself
+	/// @returns: length of the string
+	/// @note: bytes before the string start in its first chunk are read too, but never passed to the callback
+	template <typename TCallback>
+	inline std::size_t ScanString(const char* szSource, TCallback&& fnSpan) noexcept
+	{
+	#ifdef Q_HASH_SIMD_SCAN_STRING
+		const __m128i xmmZero = _mm_setzero_si128();
+		const char* pChunk = reinterpret_cast<const char*>(reinterpret_cast<std::uintptr_t>(szSource) & ~static_cast<std::uintptr_t>(15U));
+
+		// mask out the bytes of the first chunk that precede the string
+		std::uint32_t uMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(pChunk)), xmmZero))) & (~0U << (szSource - pChunk));
+		while (uMask == 0U)
+		{
+			pChunk += sizeof(__m128i);
+			fnSpan(reinterpret_cast<const std::uint8_t*>(pChunk));
+			uMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(pChunk)), xmmZero)));
+		}
+
+		const char* pEnd = pChunk + std::countr_zero(uMask);
+	#else
+		const char* pEnd = szSource + std::strlen(szSource);
+	#endif
+		fnSpan(reinterpret_cast<const std::uint8_t*>(pEnd));
+		return static_cast<std::size_t>(pEnd - szSource);
+	}
+}
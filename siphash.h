@@ -0,0 +1,519 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] endian, rotl
+#include <bit>
+// used: [stl] random_device
+#include <random>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+#if Q_HAS_INCLUDE("q-tee/crt/crt.h")
+// used: stringlength
+#include <q-tee/crt/crt.h>
+#endif
+
+// used: scanstring
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+#define Q_HASH_SIPHASH
+
+#ifndef Q_HASH_SIPHASH_FIRST
+#define Q_HASH_SIPHASH_FIRST 0x736F6D6570736575
+#endif
+
+#ifndef Q_HASH_SIPHASH_SECOND
+#define Q_HASH_SIPHASH_SECOND 0x646F72616E646F6D
+#endif
+
+#ifndef Q_HASH_SIPHASH_THIRD
+#define Q_HASH_SIPHASH_THIRD 0x6C7967656E657261
+#endif
+
+#ifndef Q_HASH_SIPHASH_FOURTH
+#define Q_HASH_SIPHASH_FOURTH 0x7465646279746573
+#endif
+
+using SipHash_t = std::uint64_t;
+
+/// 128-bit secret key, where the first half holds the little-endian first 8 bytes of the canonical key
+struct SipHashKey_t
+{
+	std::uint64_t ullFirst;
+	std::uint64_t ullSecond;
+
+	constexpr bool operator==(const SipHashKey_t&) const noexcept = default;
+};
+
+/*
+ * SIPHASH KEYED PSEUDO-RANDOM FUNCTION
+ * @note: unlike the seeded algorithms, the colliding keys can't be crafted without knowing the secret key, so the hash tables that are filled by the untrusted input should use it with the per-process random key
+ * @credits: Jean-Philippe Aumasson, Daniel J. Bernstein
+ */
+namespace SIPHASH
+{
+	namespace DETAIL
+	{
+		/// four words of the internal state, kept as the separate values so they stay in the registers through the rounds
+		struct State_t
+		{
+			std::uint64_t ullV0;
+			std::uint64_t ullV1;
+			std::uint64_t ullV2;
+			std::uint64_t ullV3;
+		};
+
+		/// @returns: initial state for the given key
+		constexpr State_t MakeState(const SipHashKey_t& key) noexcept
+		{
+			return { key.ullFirst ^ Q_HASH_SIPHASH_FIRST, key.ullSecond ^ Q_HASH_SIPHASH_SECOND, key.ullFirst ^ Q_HASH_SIPHASH_THIRD, key.ullSecond ^ Q_HASH_SIPHASH_FOURTH };
+		}
+
+		/// @returns: endian-independent load of the given count of bytes, up to 8
+		template <typename T>
+		constexpr std::uint64_t LoadBytes(const T* pSource, const std::size_t nLength) noexcept
+		{
+			std::uint64_t ullResult = 0U;
+			for (std::size_t i = 0U; i < nLength; ++i)
+				ullResult |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
+
+			return ullResult;
+		}
+
+		/// @returns: endian-independent load of 8 bytes
+		template <typename T>
+		constexpr std::uint64_t LoadBlock(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint64_t*>(pSource);
+			}
+
+			return LoadBytes(pSource, sizeof(std::uint64_t));
+		}
+
+		/// apply the given count of the add-rotate-xor rounds to the state
+		template <std::size_t ROUNDS>
+		constexpr void Round(State_t& state) noexcept
+		{
+			for (std::size_t i = 0U; i < ROUNDS; ++i)
+			{
+				state.ullV0 += state.ullV1;
+				state.ullV1 = std::rotl(state.ullV1, 13);
+				state.ullV1 ^= state.ullV0;
+				state.ullV0 = std::rotl(state.ullV0, 32);
+				state.ullV2 += state.ullV3;
+				state.ullV3 = std::rotl(state.ullV3, 16);
+				state.ullV3 ^= state.ullV2;
+				state.ullV0 += state.ullV3;
+				state.ullV3 = std::rotl(state.ullV3, 21);
+				state.ullV3 ^= state.ullV0;
+				state.ullV2 += state.ullV1;
+				state.ullV1 = std::rotl(state.ullV1, 17);
+				state.ullV1 ^= state.ullV2;
+				state.ullV2 = std::rotl(state.ullV2, 32);
+			}
+		}
+
+		/// mix the given word into the state
+		template <std::size_t COMPRESSION_ROUNDS>
+		constexpr void Compress(State_t& state, const std::uint64_t ullWord) noexcept
+		{
+			state.ullV3 ^= ullWord;
+			Round<COMPRESSION_ROUNDS>(state);
+			state.ullV0 ^= ullWord;
+		}
+
+		/// @param[in] pSource buffer of which only the whole words are processed
+		/// @returns: state after compressing all the whole 8-byte words of the buffer
+		template <std::size_t COMPRESSION_ROUNDS, typename T>
+		constexpr State_t ProcessBody(const T* pSource, std::size_t nLength, State_t state) noexcept
+		{
+			for (; nLength >= sizeof(std::uint64_t); nLength -= sizeof(std::uint64_t), pSource += sizeof(std::uint64_t))
+				Compress<COMPRESSION_ROUNDS>(state, LoadBlock(pSource));
+
+			return state;
+		}
+
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nLength total length of the data in bytes, the low 3 bits of which give the count of the remaining bytes
+		/// @returns: final hash after processing the remaining bytes
+		template <std::size_t COMPRESSION_ROUNDS, std::size_t FINALIZATION_ROUNDS, typename T>
+		constexpr SipHash_t ProcessTail(const T* pSource, const std::size_t nLength, State_t state) noexcept
+		{
+			// the last word holds the low byte of the length above the remaining bytes
+			Compress<COMPRESSION_ROUNDS>(state, (static_cast<std::uint64_t>(nLength) << 56U) | LoadBytes(pSource, nLength & 7U));
+
+			state.ullV2 ^= 0xFF;
+			Round<FINALIZATION_ROUNDS>(state);
+			return state.ullV0 ^ state.ullV1 ^ state.ullV2 ^ state.ullV3;
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <std::size_t COMPRESSION_ROUNDS, std::size_t FINALIZATION_ROUNDS, typename T>
+		constexpr SipHash_t HashBytes(const T* pSource, const std::size_t nLength, const SipHashKey_t& key) noexcept
+		{
+			const State_t state = ProcessBody<COMPRESSION_ROUNDS>(pSource, nLength, MakeState(key));
+			return ProcessTail<COMPRESSION_ROUNDS, FINALIZATION_ROUNDS>(pSource + (nLength & ~static_cast<std::size_t>(7U)), nLength, state);
+		}
+
+		template <std::size_t COMPRESSION_ROUNDS, std::size_t FINALIZATION_ROUNDS>
+		SipHash_t HashString(const char* szSource, const SipHashKey_t& key) noexcept
+		{
+			// the length is mixed only into the last word, so the whole words are compressed right behind the terminator search
+			State_t state = MakeState(key);
+			const std::uint8_t* pWord = reinterpret_cast<const std::uint8_t*>(szSource);
+			const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [&](const std::uint8_t* pSpanEnd)
+			{
+				const std::size_t nBodyLength = static_cast<std::size_t>(pSpanEnd - pWord) & ~static_cast<std::size_t>(7U);
+				state = ProcessBody<COMPRESSION_ROUNDS>(pWord, nBodyLength, state);
+				pWord += nBodyLength;
+			});
+
+			return ProcessTail<COMPRESSION_ROUNDS, FINALIZATION_ROUNDS>(pWord, nLength, state);
+		}
+
+		consteval std::size_t StringLength(const char* szSource) noexcept
+		{
+#ifdef Q_CRT
+			return CRT::StringLength(szSource);
+#else
+			const char* szSourceEnd = szSource;
+			while (*szSourceEnd != '\0')
+				++szSourceEnd;
+
+			return szSourceEnd - szSource;
+#endif
+		}
+
+		/* @section: stream */
+		/// incremental hash generation of the data split across multiple buffers
+		template <std::size_t COMPRESSION_ROUNDS, std::size_t FINALIZATION_ROUNDS>
+		class CStream
+		{
+		public:
+			/// @param[in] key secret key of the hash generation
+			explicit CStream(const SipHashKey_t& key) noexcept
+			{
+				Init(key);
+			}
+
+			/// reset the state to begin a new hash generation
+			/// @param[in] key secret key of the hash generation
+			void Init(const SipHashKey_t& key) noexcept
+			{
+				state = MakeState(key);
+				nTotalLength = 0U;
+				nTailLength = 0U;
+			}
+
+			/// @param[in] pSource next buffer of the data
+			/// @param[in] nLength length of the buffer in bytes
+			void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+			{
+				nTotalLength += nLength;
+
+				// complete the word that was left from the previous buffer
+				if (nTailLength != 0U)
+				{
+					while (nTailLength < sizeof(arrTail) && nLength != 0U)
+					{
+						arrTail[nTailLength++] = *pSource++;
+						--nLength;
+					}
+
+					if (nTailLength < sizeof(arrTail))
+						return;
+
+					Compress<COMPRESSION_ROUNDS>(state, LoadBlock(arrTail));
+					nTailLength = 0U;
+				}
+
+				state = ProcessBody<COMPRESSION_ROUNDS>(pSource, nLength, state);
+
+				// keep the remaining bytes until the next buffer
+				for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(7U)); nTailLength < (nLength & 7U); ++nTailLength)
+					arrTail[nTailLength] = pTail[nTailLength];
+			}
+
+			/// @param[in] ppSources array of the next buffers of the data, in order
+			/// @param[in] pLengths array of the length of each buffer in bytes
+			/// @param[in] nCount count of the buffers
+			void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+			{
+				for (std::size_t i = 0U; i < nCount; ++i)
+					Update(ppSources[i], pLengths[i]);
+			}
+
+			/// @returns: calculated hash of the all appended data
+			[[nodiscard]] SipHash_t Final() const noexcept
+			{
+				return ProcessTail<COMPRESSION_ROUNDS, FINALIZATION_ROUNDS>(arrTail, nTotalLength, state);
+			}
+
+		private:
+			State_t state;
+			std::size_t nTotalLength;
+			std::uint8_t arrTail[sizeof(std::uint64_t)];
+			std::size_t nTailLength;
+		};
+	}
+
+	/// @returns: new key filled from the system entropy source
+	/// @note: terminates when the entropy source is unavailable, rather than falling back to the predictable key
+	inline SipHashKey_t GenerateKey() noexcept
+	{
+		std::random_device randomDevice;
+		const auto Next = [&randomDevice]()
+		{
+			return (static_cast<std::uint64_t>(randomDevice()) << 32U) | static_cast<std::uint32_t>(randomDevice());
+		};
+
+		const std::uint64_t ullFirst = Next();
+		return { ullFirst, Next() };
+	}
+
+	/// @returns: random key, that is generated once on the first call and then shared by the whole process
+	/// @note: hashes made with it differ between the runs, so they must never be stored or sent elsewhere
+	inline const SipHashKey_t& GetProcessKey() noexcept
+	{
+		static const SipHashKey_t key = GenerateKey();
+		return key;
+	}
+}
+
+/*
+ * SIPHASH-1-3
+ * @note: one compression and three finalization rounds, the faster variant that is sufficient for the hash tables
+ */
+namespace SIPHASH_13
+{
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr SipHash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<1U, 3U>(pSource, nLength, key);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline SipHash_t Hash(const char* szSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashString<1U, 3U>(szSource, key);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr SipHash_t Hash(const std::string_view strSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<1U, 3U>(strSource.data(), strSource.size(), key);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval SipHash_t HashConst(const char* szSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<1U, 3U>(szSource, SIPHASH::DETAIL::StringLength(szSource), key);
+	}
+
+	using CStream = SIPHASH::DETAIL::CStream<1U, 3U>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline SipHash_t Hash(const TChar* szSource, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(key), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline SipHash_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(key), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval SipHash_t HashConst(const TChar* szSource, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [&key](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, key); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval SipHash_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [&key](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, key); });
+	}
+}
+
+/*
+ * SIPHASH-2-4
+ * @note: two compression and four finalization rounds, the conservative variant of the original paper
+ */
+namespace SIPHASH_24
+{
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr SipHash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<2U, 4U>(pSource, nLength, key);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline SipHash_t Hash(const char* szSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashString<2U, 4U>(szSource, key);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr SipHash_t Hash(const std::string_view strSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<2U, 4U>(strSource.data(), strSource.size(), key);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval SipHash_t HashConst(const char* szSource, const SipHashKey_t& key) noexcept
+	{
+		return SIPHASH::DETAIL::HashBytes<2U, 4U>(szSource, SIPHASH::DETAIL::StringLength(szSource), key);
+	}
+
+	using CStream = SIPHASH::DETAIL::CStream<2U, 4U>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline SipHash_t Hash(const TChar* szSource, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(key), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline SipHash_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(key), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval SipHash_t HashConst(const TChar* szSource, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [&key](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, key); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] key secret key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval SipHash_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const SipHashKey_t& key) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [&key](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, key); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ * @note: the default tags are keyed by the process key with the 32-bit seed mixed into it, so the generic containers keep the protection against the crafted collisions, but their hashes differ between the runs and have no compile-time counterpart
+ * the '_FIXED_KEY' tags use the seed as the low half of the otherwise zero key instead, for the reproducible hashes of the trusted input only
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct SIPHASH_13
+	{
+		using Hash_t = SipHash_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed value that is mixed into the process key
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			const SipHashKey_t& key = ::SIPHASH::GetProcessKey();
+			return ::SIPHASH_13::Hash(pSource, nLength, SipHashKey_t{ key.ullFirst ^ uSeed, key.ullSecond });
+		}
+	};
+
+	struct SIPHASH_24
+	{
+		using Hash_t = SipHash_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed value that is mixed into the process key
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			const SipHashKey_t& key = ::SIPHASH::GetProcessKey();
+			return ::SIPHASH_24::Hash(pSource, nLength, SipHashKey_t{ key.ullFirst ^ uSeed, key.ullSecond });
+		}
+	};
+
+	struct SIPHASH_13_FIXED_KEY
+	{
+		using Hash_t = SipHash_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed low half of the public key
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::SIPHASH_13::Hash(pSource, nLength, SipHashKey_t{ uSeed, 0U });
+		}
+
+		/// @param[in] uSeed low half of the public key
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::SIPHASH_13::HashConst(szSource, SipHashKey_t{ uSeed, 0U });
+		}
+	};
+
+	struct SIPHASH_24_FIXED_KEY
+	{
+		using Hash_t = SipHash_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed low half of the public key
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::SIPHASH_24::Hash(pSource, nLength, SipHashKey_t{ uSeed, 0U });
+		}
+
+		/// @param[in] uSeed low half of the public key
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::SIPHASH_24::HashConst(szSource, SipHashKey_t{ uSeed, 0U });
+		}
+	};
+}
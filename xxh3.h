@@ -0,0 +1,1094 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] endian, rotl
+#include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated, is_same_v
+#include <type_traits>
+
+#if Q_HAS_INCLUDE("q-tee/crt/crt.h")
+// used: stringlength
+#include <q-tee/crt/crt.h>
+#endif
+
+// used: Q_HASH_CPU_X86, Q_HASH_CPU_X64, Q_HASH_SIMD_SSE2, Q_HASH_TARGET, hasfeatures, cdispatch, scanstring
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+#ifndef Q_HASH_XXH3_NO_AVX2
+#ifdef Q_HASH_CPU_X86
+#define Q_HASH_XXH3_AVX2
+#endif
+#endif
+
+#define Q_HASH_XXH3
+
+#ifndef Q_HASH_XXH3_PRIME32_FIRST
+#define Q_HASH_XXH3_PRIME32_FIRST 0x9E3779B1
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME32_SECOND
+#define Q_HASH_XXH3_PRIME32_SECOND 0x85EBCA77
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME32_THIRD
+#define Q_HASH_XXH3_PRIME32_THIRD 0xC2B2AE3D
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME64_FIRST
+#define Q_HASH_XXH3_PRIME64_FIRST 0x9E3779B185EBCA87
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME64_SECOND
+#define Q_HASH_XXH3_PRIME64_SECOND 0xC2B2AE3D27D4EB4F
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME64_THIRD
+#define Q_HASH_XXH3_PRIME64_THIRD 0x165667B19E3779F9
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME64_FOURTH
+#define Q_HASH_XXH3_PRIME64_FOURTH 0x85EBCA77C2B2AE63
+#endif
+
+#ifndef Q_HASH_XXH3_PRIME64_FIFTH
+#define Q_HASH_XXH3_PRIME64_FIFTH 0x27D4EB2F165667C5
+#endif
+
+#ifndef Q_HASH_XXH3_AVALANCHE
+#define Q_HASH_XXH3_AVALANCHE 0x165667919E3779F9
+#endif
+
+#ifndef Q_HASH_XXH3_RRMXMX
+#define Q_HASH_XXH3_RRMXMX 0x9FB21C651E98DF25
+#endif
+
+using XXH3_t = std::uint64_t;
+
+/// 128-bit hash, where the low half holds the low 64 bits of the canonical big-endian output
+struct XXH3128_t
+{
+	std::uint64_t ullLow;
+	std::uint64_t ullHigh;
+
+	constexpr bool operator==(const XXH3128_t&) const noexcept = default;
+};
+
+/*
+ * 64-BIT XXH3 HASH ALGORITHM
+ * @note: the short inputs are mixed by the length-specialized paths, the long ones by eight 64-bit accumulators over the 64-byte stripes, that are vectorized with SSE2/AVX2 at run-time
+ * @credits: Yann Collet
+ */
+namespace XXH3
+{
+	namespace DETAIL
+	{
+		// size of the default secret, that the stripes are keyed with
+		inline constexpr std::size_t nSecretSize = 192U;
+		// the largest input hashed without the accumulators
+		inline constexpr std::size_t nMidSizeMax = 240U;
+		inline constexpr std::size_t nStripeLength = 64U;
+		// offset of the secret between the consecutive stripes
+		inline constexpr std::size_t nSecretConsumeRate = 8U;
+		inline constexpr std::size_t nStripesPerBlock = (nSecretSize - nStripeLength) / nSecretConsumeRate;
+		inline constexpr std::size_t nBlockLength = nStripeLength * nStripesPerBlock;
+		inline constexpr std::size_t nAccumulatorCount = 8U;
+
+		alignas(64) inline constexpr std::uint8_t arrDefaultSecret[nSecretSize] =
+		{
+			0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+			0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+			0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+			0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+			0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+			0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+			0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+			0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+			0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+			0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+			0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+			0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E
+		};
+
+		/// @returns: endian-independent load of the given count of bytes, up to 8
+		template <typename T>
+		constexpr std::uint64_t LoadBytes(const T* pSource, const std::size_t nLength) noexcept
+		{
+			std::uint64_t ullResult = 0U;
+			for (std::size_t i = 0U; i < nLength; ++i)
+				ullResult |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
+
+			return ullResult;
+		}
+
+		/// @returns: endian-independent load of 4 bytes
+		template <typename T>
+		constexpr std::uint32_t LoadBlock32(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint32_t*>(pSource);
+			}
+
+			return static_cast<std::uint32_t>(LoadBytes(pSource, sizeof(std::uint32_t)));
+		}
+
+		/// @returns: endian-independent load of 8 bytes
+		template <typename T>
+		constexpr std::uint64_t LoadBlock64(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint64_t*>(pSource);
+			}
+
+			return LoadBytes(pSource, sizeof(std::uint64_t));
+		}
+
+		/// endian-independent store of 8 bytes
+		constexpr void StoreBlock64(std::uint8_t* pDestination, const std::uint64_t ullValue) noexcept
+		{
+			for (std::size_t i = 0U; i < sizeof(std::uint64_t); ++i)
+				pDestination[i] = static_cast<std::uint8_t>(ullValue >> (i * 8U));
+		}
+
+		constexpr std::uint32_t ByteSwap32(const std::uint32_t uValue) noexcept
+		{
+			return (uValue >> 24U) | ((uValue >> 8U) & 0xFF00) | ((uValue << 8U) & 0xFF0000) | (uValue << 24U);
+		}
+
+		constexpr std::uint64_t ByteSwap64(const std::uint64_t ullValue) noexcept
+		{
+			return (static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(ullValue))) << 32U) | ByteSwap32(static_cast<std::uint32_t>(ullValue >> 32U));
+		}
+
+		/// @returns: full 128-bit product of the given values
+		constexpr XXH3128_t Multiply128(const std::uint64_t ullFirst, const std::uint64_t ullSecond) noexcept
+		{
+		#ifdef __SIZEOF_INT128__
+			__extension__ typedef unsigned __int128 UInt128_t;
+			const UInt128_t uProduct = static_cast<UInt128_t>(ullFirst) * ullSecond;
+			return { static_cast<std::uint64_t>(uProduct), static_cast<std::uint64_t>(uProduct >> 64U) };
+		#else
+		#if defined(_MSC_VER) && defined(Q_HASH_CPU_X64)
+			if (!std::is_constant_evaluated())
+			{
+				std::uint64_t ullHigh;
+				const std::uint64_t ullLow = _umul128(ullFirst, ullSecond, &ullHigh);
+				return { ullLow, ullHigh };
+			}
+		#endif
+
+			// multiply by the 32-bit halves and carry the middle products
+			const std::uint64_t ullLowLow = (ullFirst & 0xFFFFFFFF) * (ullSecond & 0xFFFFFFFF);
+			const std::uint64_t ullHighLow = (ullFirst >> 32U) * (ullSecond & 0xFFFFFFFF);
+			const std::uint64_t ullLowHigh = (ullFirst & 0xFFFFFFFF) * (ullSecond >> 32U);
+			const std::uint64_t ullHighHigh = (ullFirst >> 32U) * (ullSecond >> 32U);
+			const std::uint64_t ullCross = (ullLowLow >> 32U) + (ullHighLow & 0xFFFFFFFF) + ullLowHigh;
+			return { (ullCross << 32U) | (ullLowLow & 0xFFFFFFFF), (ullHighLow >> 32U) + (ullCross >> 32U) + ullHighHigh };
+		#endif
+		}
+
+		/// @returns: xor of the low and high halves of the full 128-bit product of the given values
+		constexpr std::uint64_t MultiplyFold64(const std::uint64_t ullFirst, const std::uint64_t ullSecond) noexcept
+		{
+			const XXH3128_t product = Multiply128(ullFirst, ullSecond);
+			return product.ullLow ^ product.ullHigh;
+		}
+
+		/// force all bits of a hash block to avalanche, enough for the mixed by multiplication inputs
+		constexpr std::uint64_t Avalanche(std::uint64_t ullHash) noexcept
+		{
+			ullHash ^= ullHash >> 37U;
+			ullHash *= Q_HASH_XXH3_AVALANCHE;
+			ullHash ^= ullHash >> 32U;
+			return ullHash;
+		}
+
+		/// force all bits of a hash block to avalanche, the stronger one that is used by the XXH64 finalization
+		constexpr std::uint64_t AvalancheXXH64(std::uint64_t ullHash) noexcept
+		{
+			ullHash ^= ullHash >> 33U;
+			ullHash *= Q_HASH_XXH3_PRIME64_SECOND;
+			ullHash ^= ullHash >> 29U;
+			ullHash *= Q_HASH_XXH3_PRIME64_THIRD;
+			ullHash ^= ullHash >> 32U;
+			return ullHash;
+		}
+
+		/// force all bits of a hash block to avalanche, that is strong enough for the not multiplied inputs
+		constexpr std::uint64_t AvalancheRRMXMX(std::uint64_t ullHash, const std::uint64_t ullLength) noexcept
+		{
+			ullHash ^= std::rotl(ullHash, 49) ^ std::rotl(ullHash, 24);
+			ullHash *= Q_HASH_XXH3_RRMXMX;
+			ullHash ^= (ullHash >> 35U) + ullLength;
+			ullHash *= Q_HASH_XXH3_RRMXMX;
+			ullHash ^= ullHash >> 28U;
+			return ullHash;
+		}
+
+		/// @returns: 16 bytes of the input mixed with 16 bytes of the secret
+		template <typename T>
+		constexpr std::uint64_t Mix16(const T* pSource, const std::uint8_t* pSecret, const std::uint64_t ullSeed) noexcept
+		{
+			return MultiplyFold64(LoadBlock64(pSource) ^ (LoadBlock64(pSecret) + ullSeed), LoadBlock64(pSource + 8U) ^ (LoadBlock64(pSecret + 8U) - ullSeed));
+		}
+
+		/// fill the secret, that the long inputs are keyed with, for the given non-zero seed
+		constexpr void MakeSecret(std::uint8_t* pSecret, const std::uint64_t ullSeed) noexcept
+		{
+			for (std::size_t i = 0U; i < nSecretSize; i += 16U)
+			{
+				StoreBlock64(pSecret + i, LoadBlock64(arrDefaultSecret + i) + ullSeed);
+				StoreBlock64(pSecret + i + 8U, LoadBlock64(arrDefaultSecret + i + 8U) - ullSeed);
+			}
+		}
+
+		/* @section: accumulators */
+		/// portable accumulation of the stripes, also used for the constant evaluation
+		struct KernelScalar_t
+		{
+			/// @param[in] pSource stripes to mix into the accumulators
+			/// @param[in] pSecret secret of the first stripe, each next one is keyed with the secret moved by 8 bytes
+			template <typename T>
+			static constexpr void Accumulate(std::uint64_t* pAccumulators, const T* pSource, const std::uint8_t* pSecret, std::size_t nStripes) noexcept
+			{
+				for (; nStripes != 0U; --nStripes, pSource += nStripeLength, pSecret += nSecretConsumeRate)
+				{
+					for (std::size_t i = 0U; i < nAccumulatorCount; ++i)
+					{
+						const std::uint64_t ullData = LoadBlock64(pSource + i * 8U);
+						const std::uint64_t ullKey = ullData ^ LoadBlock64(pSecret + i * 8U);
+
+						// the data is added to the neighbour lane, so it isn't lost when the key product is zero
+						pAccumulators[i ^ 1U] += ullData;
+						pAccumulators[i] += (ullKey & 0xFFFFFFFF) * (ullKey >> 32U);
+					}
+				}
+			}
+
+			/// spread the accumulated bits after each block of stripes
+			static constexpr void Scramble(std::uint64_t* pAccumulators, const std::uint8_t* pSecret) noexcept
+			{
+				for (std::size_t i = 0U; i < nAccumulatorCount; ++i)
+				{
+					std::uint64_t ullAccumulator = pAccumulators[i];
+					ullAccumulator ^= ullAccumulator >> 47U;
+					ullAccumulator ^= LoadBlock64(pSecret + i * 8U);
+					pAccumulators[i] = ullAccumulator * Q_HASH_XXH3_PRIME32_FIRST;
+				}
+			}
+		};
+
+	#ifdef Q_HASH_SIMD_SSE2
+		/// accumulation of the stripes with each two accumulators in the separate vector
+		struct KernelSSE2_t
+		{
+			static void Accumulate(std::uint64_t* pAccumulators, const std::uint8_t* pSource, const std::uint8_t* pSecret, std::size_t nStripes) noexcept
+			{
+				__m128i* pVectors = reinterpret_cast<__m128i*>(pAccumulators);
+				__m128i arrVectors[4] = { _mm_loadu_si128(pVectors), _mm_loadu_si128(pVectors + 1), _mm_loadu_si128(pVectors + 2), _mm_loadu_si128(pVectors + 3) };
+
+				for (; nStripes != 0U; --nStripes, pSource += nStripeLength, pSecret += nSecretConsumeRate)
+				{
+					for (std::size_t i = 0U; i < 4U; ++i)
+					{
+						const __m128i xmmData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource) + i);
+						const __m128i xmmKey = _mm_xor_si128(xmmData, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSecret) + i));
+						const __m128i xmmProduct = _mm_mul_epu32(xmmKey, _mm_shuffle_epi32(xmmKey, _MM_SHUFFLE(0, 3, 0, 1)));
+						arrVectors[i] = _mm_add_epi64(arrVectors[i], _mm_add_epi64(xmmProduct, _mm_shuffle_epi32(xmmData, _MM_SHUFFLE(1, 0, 3, 2))));
+					}
+				}
+
+				for (std::size_t i = 0U; i < 4U; ++i)
+					_mm_storeu_si128(pVectors + i, arrVectors[i]);
+			}
+
+			static void Scramble(std::uint64_t* pAccumulators, const std::uint8_t* pSecret) noexcept
+			{
+				__m128i* pVectors = reinterpret_cast<__m128i*>(pAccumulators);
+				const __m128i xmmPrime = _mm_set1_epi32(static_cast<int>(Q_HASH_XXH3_PRIME32_FIRST));
+
+				for (std::size_t i = 0U; i < 4U; ++i)
+				{
+					__m128i xmmAccumulator = _mm_loadu_si128(pVectors + i);
+					xmmAccumulator = _mm_xor_si128(xmmAccumulator, _mm_srli_epi64(xmmAccumulator, 47));
+					xmmAccumulator = _mm_xor_si128(xmmAccumulator, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSecret) + i));
+
+					// 64-bit multiplication by the 32-bit prime, composed of the halves
+					const __m128i xmmLow = _mm_mul_epu32(xmmAccumulator, xmmPrime);
+					const __m128i xmmHigh = _mm_mul_epu32(_mm_shuffle_epi32(xmmAccumulator, _MM_SHUFFLE(0, 3, 0, 1)), xmmPrime);
+					_mm_storeu_si128(pVectors + i, _mm_add_epi64(xmmLow, _mm_slli_epi64(xmmHigh, 32)));
+				}
+			}
+		};
+	#endif
+
+	#ifdef Q_HASH_XXH3_AVX2
+		/// accumulation of the stripes with each four accumulators in the separate vector
+		struct KernelAVX2_t
+		{
+			Q_HASH_TARGET("avx2") static void Accumulate(std::uint64_t* pAccumulators, const std::uint8_t* pSource, const std::uint8_t* pSecret, std::size_t nStripes) noexcept
+			{
+				__m256i* pVectors = reinterpret_cast<__m256i*>(pAccumulators);
+				__m256i ymmFirst = _mm256_loadu_si256(pVectors), ymmSecond = _mm256_loadu_si256(pVectors + 1);
+
+				for (; nStripes != 0U; --nStripes, pSource += nStripeLength, pSecret += nSecretConsumeRate)
+				{
+					const __m256i ymmFirstData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSource));
+					const __m256i ymmSecondData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSource) + 1);
+					const __m256i ymmFirstKey = _mm256_xor_si256(ymmFirstData, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSecret)));
+					const __m256i ymmSecondKey = _mm256_xor_si256(ymmSecondData, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSecret) + 1));
+
+					ymmFirst = _mm256_add_epi64(ymmFirst, _mm256_add_epi64(_mm256_mul_epu32(ymmFirstKey, _mm256_srli_epi64(ymmFirstKey, 32)), _mm256_shuffle_epi32(ymmFirstData, _MM_SHUFFLE(1, 0, 3, 2))));
+					ymmSecond = _mm256_add_epi64(ymmSecond, _mm256_add_epi64(_mm256_mul_epu32(ymmSecondKey, _mm256_srli_epi64(ymmSecondKey, 32)), _mm256_shuffle_epi32(ymmSecondData, _MM_SHUFFLE(1, 0, 3, 2))));
+				}
+
+				_mm256_storeu_si256(pVectors, ymmFirst);
+				_mm256_storeu_si256(pVectors + 1, ymmSecond);
+			}
+
+			Q_HASH_TARGET("avx2") static void Scramble(std::uint64_t* pAccumulators, const std::uint8_t* pSecret) noexcept
+			{
+				__m256i* pVectors = reinterpret_cast<__m256i*>(pAccumulators);
+				const __m256i ymmPrime = _mm256_set1_epi32(static_cast<int>(Q_HASH_XXH3_PRIME32_FIRST));
+
+				for (std::size_t i = 0U; i < 2U; ++i)
+				{
+					__m256i ymmAccumulator = _mm256_loadu_si256(pVectors + i);
+					ymmAccumulator = _mm256_xor_si256(ymmAccumulator, _mm256_srli_epi64(ymmAccumulator, 47));
+					ymmAccumulator = _mm256_xor_si256(ymmAccumulator, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSecret) + i));
+
+					// 64-bit multiplication by the 32-bit prime, composed of the halves
+					const __m256i ymmLow = _mm256_mul_epu32(ymmAccumulator, ymmPrime);
+					const __m256i ymmHigh = _mm256_mul_epu32(_mm256_srli_epi64(ymmAccumulator, 32), ymmPrime);
+					_mm256_storeu_si256(pVectors + i, _mm256_add_epi64(ymmLow, _mm256_slli_epi64(ymmHigh, 32)));
+				}
+			}
+		};
+	#endif
+
+		/// mix all stripes of the long input into the accumulators
+		/// @param[in] nLength length of the input in bytes, must be greater than the stripe size
+		template <typename TKernel, typename T>
+		constexpr void AccumulateLong(std::uint64_t* pAccumulators, const T* pSource, const std::size_t nLength, const std::uint8_t* pSecret) noexcept
+		{
+			const std::size_t nBlockCount = (nLength - 1U) / nBlockLength;
+			for (std::size_t nBlock = 0U; nBlock < nBlockCount; ++nBlock)
+			{
+				TKernel::Accumulate(pAccumulators, pSource + nBlock * nBlockLength, pSecret, nStripesPerBlock);
+				TKernel::Scramble(pAccumulators, pSecret + nSecretSize - nStripeLength);
+			}
+
+			// the last partial block, excluding the last stripe even when it's whole
+			const std::size_t nStripeCount = ((nLength - 1U) - nBlockLength * nBlockCount) / nStripeLength;
+			TKernel::Accumulate(pAccumulators, pSource + nBlockCount * nBlockLength, pSecret, nStripeCount);
+
+			// the last stripe, that may overlap the previous one, is keyed with the secret which is different from the others
+			TKernel::Accumulate(pAccumulators, pSource + nLength - nStripeLength, pSecret + nSecretSize - nStripeLength - 7U, 1U);
+		}
+
+	#ifdef Q_HASH_CPU_X86
+		using AccumulateLong_t = void(std::uint64_t*, const std::uint8_t*, std::size_t, const std::uint8_t*) noexcept;
+
+		inline AccumulateLong_t* ResolveAccumulateLong() noexcept
+		{
+		#ifdef Q_HASH_XXH3_AVX2
+			if (Q_HASH::CPU::HasFeatures(Q_HASH::CPU::FEATURE_AVX2))
+				return &AccumulateLong<KernelAVX2_t, std::uint8_t>;
+		#endif
+
+		#ifdef Q_HASH_SIMD_SSE2
+			return &AccumulateLong<KernelSSE2_t, std::uint8_t>;
+		#else
+			return &AccumulateLong<KernelScalar_t, std::uint8_t>;
+		#endif
+		}
+
+		using AccumulateLongDispatch_t = Q_HASH::CPU::CDispatch<AccumulateLong_t, &ResolveAccumulateLong>;
+	#endif
+
+		/// fill the accumulators with their initial values
+		constexpr void ResetAccumulators(std::uint64_t* pAccumulators) noexcept
+		{
+			const std::uint64_t arrInitial[nAccumulatorCount] = { Q_HASH_XXH3_PRIME32_THIRD, Q_HASH_XXH3_PRIME64_FIRST, Q_HASH_XXH3_PRIME64_SECOND, Q_HASH_XXH3_PRIME64_THIRD, Q_HASH_XXH3_PRIME64_FOURTH, Q_HASH_XXH3_PRIME32_SECOND, Q_HASH_XXH3_PRIME64_FIFTH, Q_HASH_XXH3_PRIME32_FIRST };
+			for (std::size_t i = 0U; i < nAccumulatorCount; ++i)
+				pAccumulators[i] = arrInitial[i];
+		}
+
+		/// @param[out] pAccumulators accumulators after mixing all stripes of the long input
+		/// @returns: secret that the input has been keyed with, either default one or the given storage filled for the seed
+		template <typename T>
+		constexpr const std::uint8_t* HashLong(std::uint64_t* pAccumulators, const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed, std::uint8_t* pSecretStorage) noexcept
+		{
+			const std::uint8_t* pSecret = arrDefaultSecret;
+			if (ullSeed != 0U)
+			{
+				MakeSecret(pSecretStorage, ullSeed);
+				pSecret = pSecretStorage;
+			}
+
+			ResetAccumulators(pAccumulators);
+
+		#ifdef Q_HASH_CPU_X86
+			if constexpr (std::is_same_v<T, std::uint8_t>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					AccumulateLongDispatch_t::Call(pAccumulators, pSource, nLength, pSecret);
+					return pSecret;
+				}
+			}
+		#endif
+
+			AccumulateLong<KernelScalar_t>(pAccumulators, pSource, nLength, pSecret);
+			return pSecret;
+		}
+
+		/// @returns: accumulators converged into the single 64-bit hash
+		constexpr std::uint64_t MergeAccumulators(const std::uint64_t* pAccumulators, const std::uint8_t* pSecret, std::uint64_t ullHash) noexcept
+		{
+			for (std::size_t i = 0U; i < nAccumulatorCount; i += 2U, pSecret += 16U)
+				ullHash += MultiplyFold64(pAccumulators[i] ^ LoadBlock64(pSecret), pAccumulators[i + 1U] ^ LoadBlock64(pSecret + 8U));
+
+			return Avalanche(ullHash);
+		}
+
+		/* @section: lengths */
+		template <typename T>
+		constexpr XXH3_t HashShort(const T* pSource, const std::size_t nLength, std::uint64_t ullSeed) noexcept
+		{
+			const std::uint8_t* pSecret = arrDefaultSecret;
+
+			if (nLength > 8U)
+			{
+				const std::uint64_t ullLow = LoadBlock64(pSource) ^ ((LoadBlock64(pSecret + 24U) ^ LoadBlock64(pSecret + 32U)) + ullSeed);
+				const std::uint64_t ullHigh = LoadBlock64(pSource + nLength - 8U) ^ ((LoadBlock64(pSecret + 40U) ^ LoadBlock64(pSecret + 48U)) - ullSeed);
+				return Avalanche(nLength + ByteSwap64(ullLow) + ullHigh + MultiplyFold64(ullLow, ullHigh));
+			}
+
+			if (nLength >= 4U)
+			{
+				ullSeed ^= static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(ullSeed))) << 32U;
+				const std::uint64_t ullInput = LoadBlock32(pSource + nLength - 4U) + (static_cast<std::uint64_t>(LoadBlock32(pSource)) << 32U);
+				return AvalancheRRMXMX(ullInput ^ ((LoadBlock64(pSecret + 8U) ^ LoadBlock64(pSecret + 16U)) - ullSeed), nLength);
+			}
+
+			if (nLength > 0U)
+			{
+				// first, middle and last bytes with the length, which covers all the bytes of 1-3 byte input
+				const std::uint32_t uCombined = (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[0])) << 16U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[nLength >> 1U])) << 24U) | static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[nLength - 1U])) | (static_cast<std::uint32_t>(nLength) << 8U);
+				return AvalancheXXH64(uCombined ^ ((LoadBlock32(pSecret) ^ LoadBlock32(pSecret + 4U)) + ullSeed));
+			}
+
+			return AvalancheXXH64(ullSeed ^ (LoadBlock64(pSecret + 56U) ^ LoadBlock64(pSecret + 64U)));
+		}
+
+		template <typename T>
+		constexpr XXH3_t HashMedium(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			std::uint64_t ullHash = nLength * Q_HASH_XXH3_PRIME64_FIRST;
+
+			// pairs of the blocks from the both ends of the input, that meet in the middle
+			for (std::size_t i = 0U; i <= (nLength - 1U) / 32U; ++i)
+			{
+				ullHash += Mix16(pSource + 16U * i, arrDefaultSecret + 32U * i, ullSeed);
+				ullHash += Mix16(pSource + nLength - 16U * (i + 1U), arrDefaultSecret + 32U * i + 16U, ullSeed);
+			}
+
+			return Avalanche(ullHash);
+		}
+
+		template <typename T>
+		constexpr XXH3_t HashMidSize(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			std::uint64_t ullHash = nLength * Q_HASH_XXH3_PRIME64_FIRST;
+			for (std::size_t i = 0U; i < 8U; ++i)
+				ullHash += Mix16(pSource + 16U * i, arrDefaultSecret + 16U * i, ullSeed);
+
+			// the last bytes, keyed with the end of the minimal secret
+			std::uint64_t ullHashEnd = Mix16(pSource + nLength - 16U, arrDefaultSecret + 136U - 17U, ullSeed);
+			for (std::size_t i = 8U; i < nLength / 16U; ++i)
+				ullHashEnd += Mix16(pSource + 16U * i, arrDefaultSecret + 16U * (i - 8U) + 3U, ullSeed);
+
+			return Avalanche(Avalanche(ullHash) + ullHashEnd);
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr XXH3_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			if (nLength <= 16U)
+				return HashShort(pSource, nLength, ullSeed);
+
+			if (nLength <= 128U)
+				return HashMedium(pSource, nLength, ullSeed);
+
+			if (nLength <= nMidSizeMax)
+				return HashMidSize(pSource, nLength, ullSeed);
+
+			std::uint64_t arrAccumulators[nAccumulatorCount];
+			std::uint8_t arrSecret[nSecretSize];
+			const std::uint8_t* pSecret = HashLong(arrAccumulators, pSource, nLength, ullSeed, arrSecret);
+			return MergeAccumulators(arrAccumulators, pSecret + 11U, nLength * Q_HASH_XXH3_PRIME64_FIRST);
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr XXH3_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline XXH3_t Hash(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		// the mixing path is chosen by the length, so the string is hashed right after the vectorized terminator search, while it's still in the cache
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [](const std::uint8_t*) { });
+		return DETAIL::HashBytes(reinterpret_cast<const std::uint8_t*>(szSource), nLength, ullSeed);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr XXH3_t Hash(const std::string_view strSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return DETAIL::HashBytes(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), ullSeed);
+
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval XXH3_t HashConst(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+#ifdef Q_CRT
+		const std::size_t nLength = CRT::StringLength(szSource);
+#else
+		const char* szSourceEnd = szSource;
+		while (*szSourceEnd != '\0')
+			++szSourceEnd;
+
+		const std::size_t nLength = szSourceEnd - szSource;
+#endif
+		return DETAIL::HashBytes(szSource, nLength, ullSeed);
+	}
+}
+
+/*
+ * 128-BIT XXH3 HASH ALGORITHM
+ * @note: shares the secret and the long input accumulation with the 64-bit one, but produces the unrelated hashes
+ * @credits: Yann Collet
+ */
+namespace XXH3_128
+{
+	namespace DETAIL
+	{
+		using namespace ::XXH3::DETAIL;
+
+		/// @returns: hash of the mid-size input after mixing 32 bytes, given as two 16-byte halves, into it
+		template <typename T>
+		constexpr XXH3128_t Mix32(XXH3128_t hash, const T* pFirst, const T* pSecond, const std::uint8_t* pSecret, const std::uint64_t ullSeed) noexcept
+		{
+			hash.ullLow += Mix16(pFirst, pSecret, ullSeed);
+			hash.ullLow ^= LoadBlock64(pSecond) + LoadBlock64(pSecond + 8U);
+			hash.ullHigh += Mix16(pSecond, pSecret + 16U, ullSeed);
+			hash.ullHigh ^= LoadBlock64(pFirst) + LoadBlock64(pFirst + 8U);
+			return hash;
+		}
+
+		/// @returns: final hash of the 17-240 byte input
+		constexpr XXH3128_t FinalizeMidSize(const XXH3128_t& hash, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			const std::uint64_t ullLow = hash.ullLow + hash.ullHigh;
+			const std::uint64_t ullHigh = (hash.ullLow * Q_HASH_XXH3_PRIME64_FIRST) + (hash.ullHigh * Q_HASH_XXH3_PRIME64_FOURTH) + ((nLength - ullSeed) * Q_HASH_XXH3_PRIME64_SECOND);
+			return { Avalanche(ullLow), 0U - Avalanche(ullHigh) };
+		}
+
+		/* @section: lengths */
+		template <typename T>
+		constexpr XXH3128_t HashShort(const T* pSource, const std::size_t nLength, std::uint64_t ullSeed) noexcept
+		{
+			const std::uint8_t* pSecret = arrDefaultSecret;
+
+			if (nLength > 8U)
+			{
+				std::uint64_t ullHigh = LoadBlock64(pSource + nLength - 8U);
+				XXH3128_t product = Multiply128(LoadBlock64(pSource) ^ ullHigh ^ ((LoadBlock64(pSecret + 32U) ^ LoadBlock64(pSecret + 40U)) - ullSeed), Q_HASH_XXH3_PRIME64_FIRST);
+				product.ullLow += static_cast<std::uint64_t>(nLength - 1U) << 54U;
+				ullHigh ^= (LoadBlock64(pSecret + 48U) ^ LoadBlock64(pSecret + 56U)) + ullSeed;
+				product.ullHigh += ullHigh + (ullHigh & 0xFFFFFFFF) * (Q_HASH_XXH3_PRIME32_SECOND - 1U);
+				product.ullLow ^= ByteSwap64(product.ullHigh);
+
+				XXH3128_t hash = Multiply128(product.ullLow, Q_HASH_XXH3_PRIME64_SECOND);
+				hash.ullHigh += product.ullHigh * Q_HASH_XXH3_PRIME64_SECOND;
+				return { Avalanche(hash.ullLow), Avalanche(hash.ullHigh) };
+			}
+
+			if (nLength >= 4U)
+			{
+				ullSeed ^= static_cast<std::uint64_t>(ByteSwap32(static_cast<std::uint32_t>(ullSeed))) << 32U;
+				const std::uint64_t ullInput = LoadBlock32(pSource) + (static_cast<std::uint64_t>(LoadBlock32(pSource + nLength - 4U)) << 32U);
+				const std::uint64_t ullKeyed = ullInput ^ ((LoadBlock64(pSecret + 16U) ^ LoadBlock64(pSecret + 24U)) + ullSeed);
+
+				// the shifted length is even, which avoids the even multiplier
+				XXH3128_t hash = Multiply128(ullKeyed, Q_HASH_XXH3_PRIME64_FIRST + (nLength << 2U));
+				hash.ullHigh += hash.ullLow << 1U;
+				hash.ullLow ^= hash.ullHigh >> 3U;
+				hash.ullLow ^= hash.ullLow >> 35U;
+				hash.ullLow *= Q_HASH_XXH3_RRMXMX;
+				hash.ullLow ^= hash.ullLow >> 28U;
+				hash.ullHigh = Avalanche(hash.ullHigh);
+				return hash;
+			}
+
+			if (nLength > 0U)
+			{
+				// first, middle and last bytes with the length, which covers all the bytes of 1-3 byte input
+				const std::uint32_t uCombinedLow = (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[0])) << 16U) | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[nLength >> 1U])) << 24U) | static_cast<std::uint32_t>(static_cast<std::uint8_t>(pSource[nLength - 1U])) | (static_cast<std::uint32_t>(nLength) << 8U);
+				const std::uint32_t uCombinedHigh = std::rotl(ByteSwap32(uCombinedLow), 13);
+				return { AvalancheXXH64(uCombinedLow ^ ((LoadBlock32(pSecret) ^ LoadBlock32(pSecret + 4U)) + ullSeed)), AvalancheXXH64(uCombinedHigh ^ ((LoadBlock32(pSecret + 8U) ^ LoadBlock32(pSecret + 12U)) - ullSeed)) };
+			}
+
+			return { AvalancheXXH64(ullSeed ^ LoadBlock64(pSecret + 64U) ^ LoadBlock64(pSecret + 72U)), AvalancheXXH64(ullSeed ^ LoadBlock64(pSecret + 80U) ^ LoadBlock64(pSecret + 88U)) };
+		}
+
+		template <typename T>
+		constexpr XXH3128_t HashMedium(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			XXH3128_t hash = { nLength * Q_HASH_XXH3_PRIME64_FIRST, 0U };
+
+			// pairs of the blocks from the both ends of the input, that meet in the middle, starting from the innermost one
+			for (std::size_t i = (nLength - 1U) / 32U + 1U; i-- != 0U;)
+				hash = Mix32(hash, pSource + 16U * i, pSource + nLength - 16U * (i + 1U), arrDefaultSecret + 32U * i, ullSeed);
+
+			return FinalizeMidSize(hash, nLength, ullSeed);
+		}
+
+		template <typename T>
+		constexpr XXH3128_t HashMidSize(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			XXH3128_t hash = { nLength * Q_HASH_XXH3_PRIME64_FIRST, 0U };
+			for (std::size_t i = 32U; i < 160U; i += 32U)
+				hash = Mix32(hash, pSource + i - 32U, pSource + i - 16U, arrDefaultSecret + i - 32U, ullSeed);
+
+			hash = { Avalanche(hash.ullLow), Avalanche(hash.ullHigh) };
+
+			for (std::size_t i = 160U; i <= nLength; i += 32U)
+				hash = Mix32(hash, pSource + i - 32U, pSource + i - 16U, arrDefaultSecret + 3U + i - 160U, ullSeed);
+
+			// the last bytes, keyed with the end of the minimal secret
+			hash = Mix32(hash, pSource + nLength - 16U, pSource + nLength - 32U, arrDefaultSecret + 136U - 17U - 16U, 0U - ullSeed);
+			return FinalizeMidSize(hash, nLength, ullSeed);
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr XXH3128_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			if (nLength <= 16U)
+				return HashShort(pSource, nLength, ullSeed);
+
+			if (nLength <= 128U)
+				return HashMedium(pSource, nLength, ullSeed);
+
+			if (nLength <= nMidSizeMax)
+				return HashMidSize(pSource, nLength, ullSeed);
+
+			std::uint64_t arrAccumulators[nAccumulatorCount];
+			std::uint8_t arrSecret[nSecretSize];
+			const std::uint8_t* pSecret = HashLong(arrAccumulators, pSource, nLength, ullSeed, arrSecret);
+			return { MergeAccumulators(arrAccumulators, pSecret + 11U, nLength * Q_HASH_XXH3_PRIME64_FIRST), MergeAccumulators(arrAccumulators, pSecret + nSecretSize - nStripeLength - 11U, ~(nLength * Q_HASH_XXH3_PRIME64_SECOND)) };
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr XXH3128_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline XXH3128_t Hash(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		// the mixing path is chosen by the length, so the string is hashed right after the vectorized terminator search, while it's still in the cache
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [](const std::uint8_t*) { });
+		return DETAIL::HashBytes(reinterpret_cast<const std::uint8_t*>(szSource), nLength, ullSeed);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr XXH3128_t Hash(const std::string_view strSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return DETAIL::HashBytes(reinterpret_cast<const std::uint8_t*>(strSource.data()), strSource.size(), ullSeed);
+
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval XXH3128_t HashConst(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+#ifdef Q_CRT
+		const std::size_t nLength = CRT::StringLength(szSource);
+#else
+		const char* szSourceEnd = szSource;
+		while (*szSourceEnd != '\0')
+			++szSourceEnd;
+
+		const std::size_t nLength = szSourceEnd - szSource;
+#endif
+		return DETAIL::HashBytes(szSource, nLength, ullSeed);
+	}
+}
+
+/*
+ * INCREMENTAL XXH3 HASH GENERATION, SHARED BY BOTH WIDTHS
+ */
+namespace XXH3::DETAIL
+{
+	// count of the bytes kept before their stripes are accumulated, must be a multiple of the stripe size
+	inline constexpr std::size_t nStreamBufferLength = 256U;
+
+#ifdef Q_HASH_SIMD_SSE2
+	using KernelStream_t = KernelSSE2_t;
+#else
+	using KernelStream_t = KernelScalar_t;
+#endif
+
+	/// accumulate the stripes that are known to precede the last one, scrambling the accumulators at the end of each block
+	/// @param[in,out] nBlockStripes count of the stripes already accumulated in the current block
+	/// @param[in] nStripes count of the stripes to accumulate, less than the block
+	inline void ConsumeStripes(std::uint64_t* pAccumulators, std::size_t& nBlockStripes, const std::uint8_t* pSource, const std::size_t nStripes, const std::uint8_t* pSecret) noexcept
+	{
+		const std::size_t nBlockRemainingStripes = nStripesPerBlock - nBlockStripes;
+		if (nStripes >= nBlockRemainingStripes)
+		{
+			KernelStream_t::Accumulate(pAccumulators, pSource, pSecret + nBlockStripes * nSecretConsumeRate, nBlockRemainingStripes);
+			KernelStream_t::Scramble(pAccumulators, pSecret + nSecretSize - nStripeLength);
+			KernelStream_t::Accumulate(pAccumulators, pSource + nBlockRemainingStripes * nStripeLength, pSecret, nStripes - nBlockRemainingStripes);
+			nBlockStripes = nStripes - nBlockRemainingStripes;
+		}
+		else
+		{
+			KernelStream_t::Accumulate(pAccumulators, pSource, pSecret + nBlockStripes * nSecretConsumeRate, nStripes);
+			nBlockStripes += nStripes;
+		}
+	}
+
+	/// incremental hash generation of the data split across multiple buffers
+	/// @note: the stripes are accumulated only when there's more data behind them, since the last stripe is keyed differently, so the inputs up to the buffer size are hashed at once by the final
+	template <typename THash>
+	class CStream
+	{
+	public:
+		/// @param[in] ullSeed initial key of the hash generation
+		explicit CStream(const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			Init(ullSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] ullSeed initial key of the hash generation
+		void Init(const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			ullStreamSeed = ullSeed;
+			if (ullSeed != 0U)
+				MakeSecret(arrSecret, ullSeed);
+
+			ResetAccumulators(arrAccumulators);
+			nTotalLength = 0U;
+			nBufferedLength = 0U;
+			nBlockStripes = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			nTotalLength += nLength;
+
+			if (nLength <= nStreamBufferLength - nBufferedLength)
+			{
+				for (std::size_t i = 0U; i < nLength; ++i)
+					arrBuffer[nBufferedLength + i] = pSource[i];
+
+				nBufferedLength += nLength;
+				return;
+			}
+
+			const std::uint8_t* pSecret = GetSecret();
+			const std::uint8_t* pConsumedEnd = pSource;
+
+			// complete the buffer that was left from the previous data, there's at least one more byte behind it
+			if (nBufferedLength != 0U)
+			{
+				const std::size_t nFillLength = nStreamBufferLength - nBufferedLength;
+				for (std::size_t i = 0U; i < nFillLength; ++i)
+					arrBuffer[nBufferedLength + i] = pSource[i];
+
+				pSource += nFillLength;
+				nLength -= nFillLength;
+
+				ConsumeStripes(arrAccumulators, nBlockStripes, arrBuffer, nStreamBufferLength / nStripeLength, pSecret);
+				pConsumedEnd = arrBuffer + nStreamBufferLength;
+				nBufferedLength = 0U;
+			}
+
+			for (; nLength > nStreamBufferLength; pSource += nStreamBufferLength, nLength -= nStreamBufferLength)
+			{
+				ConsumeStripes(arrAccumulators, nBlockStripes, pSource, nStreamBufferLength / nStripeLength, pSecret);
+				pConsumedEnd = pSource + nStreamBufferLength;
+			}
+
+			// keep the last accumulated stripe, that the final one overlaps when there are less than the stripe of the remaining bytes
+			for (std::size_t i = 0U; i < nStripeLength; ++i)
+				arrLastStripe[i] = (pConsumedEnd - nStripeLength)[i];
+
+			for (std::size_t i = 0U; i < nLength; ++i)
+				arrBuffer[i] = pSource[i];
+
+			nBufferedLength = nLength;
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] THash Final() const noexcept
+		{
+			// all data is still in the buffer
+			if (nTotalLength <= nMidSizeMax)
+			{
+				if constexpr (std::is_same_v<THash, XXH3128_t>)
+					return ::XXH3_128::DETAIL::HashBytes(arrBuffer, nTotalLength, ullStreamSeed);
+				else
+					return HashBytes(arrBuffer, nTotalLength, ullStreamSeed);
+			}
+
+			const std::uint8_t* pSecret = GetSecret();
+			std::uint64_t arrFinalAccumulators[nAccumulatorCount];
+			for (std::size_t i = 0U; i < nAccumulatorCount; ++i)
+				arrFinalAccumulators[i] = arrAccumulators[i];
+
+			std::uint8_t arrStripe[nStripeLength];
+			const std::uint8_t* pLastStripe = arrStripe;
+			if (nBufferedLength >= nStripeLength)
+			{
+				std::size_t nFinalBlockStripes = nBlockStripes;
+				ConsumeStripes(arrFinalAccumulators, nFinalBlockStripes, arrBuffer, (nBufferedLength - 1U) / nStripeLength, pSecret);
+				pLastStripe = arrBuffer + nBufferedLength - nStripeLength;
+			}
+			// compose the last stripe of the end of the previously accumulated one and the remaining bytes
+			else
+			{
+				const std::size_t nPreviousLength = nStripeLength - nBufferedLength;
+				for (std::size_t i = 0U; i < nPreviousLength; ++i)
+					arrStripe[i] = arrLastStripe[nBufferedLength + i];
+
+				for (std::size_t i = 0U; i < nBufferedLength; ++i)
+					arrStripe[nPreviousLength + i] = arrBuffer[i];
+			}
+
+			KernelStream_t::Accumulate(arrFinalAccumulators, pLastStripe, pSecret + nSecretSize - nStripeLength - 7U, 1U);
+
+			const std::uint64_t ullLow = MergeAccumulators(arrFinalAccumulators, pSecret + 11U, nTotalLength * Q_HASH_XXH3_PRIME64_FIRST);
+			if constexpr (std::is_same_v<THash, XXH3128_t>)
+				return { ullLow, MergeAccumulators(arrFinalAccumulators, pSecret + nSecretSize - nStripeLength - 11U, ~(nTotalLength * Q_HASH_XXH3_PRIME64_SECOND)) };
+			else
+				return ullLow;
+		}
+
+	private:
+		/// @returns: secret that the data is keyed with, either default one or the one filled for the seed
+		const std::uint8_t* GetSecret() const noexcept
+		{
+			return (ullStreamSeed != 0U) ? arrSecret : arrDefaultSecret;
+		}
+
+		std::uint64_t arrAccumulators[nAccumulatorCount];
+		std::uint8_t arrBuffer[nStreamBufferLength];
+		std::uint8_t arrLastStripe[nStripeLength];
+		std::uint8_t arrSecret[nSecretSize];
+		std::uint64_t ullStreamSeed;
+		std::size_t nTotalLength;
+		std::size_t nBufferedLength;
+		std::size_t nBlockStripes;
+	};
+}
+
+namespace XXH3
+{
+	using CStream = DETAIL::CStream<XXH3_t>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline XXH3_t Hash(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline XXH3_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval XXH3_t HashConst(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval XXH3_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+}
+
+namespace XXH3_128
+{
+	using CStream = XXH3::DETAIL::CStream<XXH3128_t>;
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline XXH3128_t Hash(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline XXH3128_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval XXH3128_t HashConst(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval XXH3128_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct XXH3
+	{
+		using Hash_t = XXH3_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH3::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH3::HashConst(szSource, uSeed);
+		}
+	};
+
+	struct XXH3_128
+	{
+		using Hash_t = XXH3128_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH3_128::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH3_128::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_xxh3'
+	consteval XXH3_t operator""_xxh3(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return XXH3::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_xxh3_128'
+	consteval XXH3128_t operator""_xxh3_128(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return XXH3_128::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+}
+#endif
@@ -0,0 +1,377 @@
+#pragma once
+// used: [stl] size_t
+#include <cstddef>
+// used: [stl] uint8_t, uint32_t, uint64_t
+#include <cstdint>
+// used: [stl] endian, rotl
+#include <bit>
+// used: [stl] string_view
+#include <string_view>
+// used: [stl] is_constant_evaluated
+#include <type_traits>
+
+#if Q_HAS_INCLUDE("q-tee/crt/crt.h")
+// used: stringlength
+#include <q-tee/crt/crt.h>
+#endif
+
+// used: scanstring
+#include "simd.h"
+// used: ignorecase_t, iswidecharacter, ischaracter, hashstring, hashconst
+#include "fold.h"
+
+#define Q_HASH_XXH64
+
+#ifndef Q_HASH_XXH64_FIRST
+#define Q_HASH_XXH64_FIRST 0x9E3779B185EBCA87
+#endif
+
+#ifndef Q_HASH_XXH64_SECOND
+#define Q_HASH_XXH64_SECOND 0xC2B2AE3D27D4EB4F
+#endif
+
+#ifndef Q_HASH_XXH64_THIRD
+#define Q_HASH_XXH64_THIRD 0x165667B19E3779F9
+#endif
+
+#ifndef Q_HASH_XXH64_FOURTH
+#define Q_HASH_XXH64_FOURTH 0x85EBCA77C2B2AE63
+#endif
+
+#ifndef Q_HASH_XXH64_FIFTH
+#define Q_HASH_XXH64_FIFTH 0x27D4EB2F165667C5
+#endif
+
+using XXH64_t = std::uint64_t;
+
+/*
+ * 64-BIT XXHASH ALGORITHM
+ * @credits: Yann Collet
+ */
+namespace XXH64
+{
+	namespace DETAIL
+	{
+		/// four independent accumulators, that process the interleaved 8-byte lanes of each 32-byte stripe
+		struct State_t
+		{
+			std::uint64_t arrLanes[4];
+		};
+
+		/// @returns: initial state of the accumulators for the given seed
+		constexpr State_t MakeState(const std::uint64_t ullSeed) noexcept
+		{
+			return { { ullSeed + Q_HASH_XXH64_FIRST + Q_HASH_XXH64_SECOND, ullSeed + Q_HASH_XXH64_SECOND, ullSeed, ullSeed - Q_HASH_XXH64_FIRST } };
+		}
+
+		/// @returns: endian-independent load of the given count of bytes, up to 8
+		template <typename T>
+		constexpr std::uint64_t LoadBytes(const T* pSource, const std::size_t nLength) noexcept
+		{
+			std::uint64_t ullResult = 0U;
+			for (std::size_t i = 0U; i < nLength; ++i)
+				ullResult |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pSource[i])) << (i * 8U);
+
+			return ullResult;
+		}
+
+		/// @returns: endian-independent load of 8 bytes
+		template <typename T>
+		constexpr std::uint64_t LoadBlock(const T* pSource) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				if (!std::is_constant_evaluated())
+					return *reinterpret_cast<const std::uint64_t*>(pSource);
+			}
+
+			return LoadBytes(pSource, sizeof(std::uint64_t));
+		}
+
+		/// @returns: accumulator after mixing the given lane into it
+		constexpr std::uint64_t Round(std::uint64_t ullAccumulator, const std::uint64_t ullLane) noexcept
+		{
+			ullAccumulator += ullLane * Q_HASH_XXH64_SECOND;
+			ullAccumulator = std::rotl(ullAccumulator, 31);
+			return ullAccumulator * Q_HASH_XXH64_FIRST;
+		}
+
+		/// @returns: hash after merging the given accumulator into it
+		constexpr std::uint64_t MergeRound(std::uint64_t ullHash, const std::uint64_t ullAccumulator) noexcept
+		{
+			ullHash ^= Round(0U, ullAccumulator);
+			return ullHash * Q_HASH_XXH64_FIRST + Q_HASH_XXH64_FOURTH;
+		}
+
+		/// @param[in] pSource buffer of which only the whole stripes are processed
+		/// @returns: accumulators after processing all the whole 32-byte stripes of the buffer
+		template <typename T>
+		constexpr State_t ProcessBody(const T* pSource, std::size_t nLength, State_t state) noexcept
+		{
+			for (; nLength >= sizeof(std::uint64_t) * 4U; nLength -= sizeof(std::uint64_t) * 4U, pSource += sizeof(std::uint64_t) * 4U)
+			{
+				for (std::size_t nLane = 0U; nLane < 4U; ++nLane)
+					state.arrLanes[nLane] = Round(state.arrLanes[nLane], LoadBlock(pSource + nLane * sizeof(std::uint64_t)));
+			}
+
+			return state;
+		}
+
+		/// @param[in] pSource remaining bytes of the buffer
+		/// @param[in] nRemainingLength count of the remaining bytes, less than stripe size
+		/// @param[in] nLength total length of the data in bytes
+		/// @returns: final hash after processing the remaining bytes
+		template <typename T>
+		constexpr XXH64_t ProcessTail(const T* pSource, std::size_t nRemainingLength, const State_t& state, const std::size_t nLength) noexcept
+		{
+			std::uint64_t ullHash;
+			if (nLength >= sizeof(std::uint64_t) * 4U)
+			{
+				ullHash = std::rotl(state.arrLanes[0], 1) + std::rotl(state.arrLanes[1], 7) + std::rotl(state.arrLanes[2], 12) + std::rotl(state.arrLanes[3], 18);
+				for (const std::uint64_t ullLane : state.arrLanes)
+					ullHash = MergeRound(ullHash, ullLane);
+			}
+			// the third accumulator is the untouched seed when there were no whole stripes
+			else
+				ullHash = state.arrLanes[2] + Q_HASH_XXH64_FIFTH;
+
+			ullHash += static_cast<std::uint64_t>(nLength);
+
+			// process the remaining length
+			for (; nRemainingLength >= sizeof(std::uint64_t); nRemainingLength -= sizeof(std::uint64_t), pSource += sizeof(std::uint64_t))
+			{
+				ullHash ^= Round(0U, LoadBlock(pSource));
+				ullHash = std::rotl(ullHash, 27) * Q_HASH_XXH64_FIRST + Q_HASH_XXH64_FOURTH;
+			}
+
+			if (nRemainingLength >= sizeof(std::uint32_t))
+			{
+				ullHash ^= LoadBytes(pSource, sizeof(std::uint32_t)) * Q_HASH_XXH64_FIRST;
+				ullHash = std::rotl(ullHash, 23) * Q_HASH_XXH64_SECOND + Q_HASH_XXH64_THIRD;
+				pSource += sizeof(std::uint32_t);
+				nRemainingLength -= sizeof(std::uint32_t);
+			}
+
+			while (nRemainingLength-- != 0U)
+			{
+				ullHash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*pSource++)) * Q_HASH_XXH64_FIFTH;
+				ullHash = std::rotl(ullHash, 11) * Q_HASH_XXH64_FIRST;
+			}
+
+			// force all bits of a hash block to avalanche
+			ullHash ^= ullHash >> 33U;
+			ullHash *= Q_HASH_XXH64_SECOND;
+			ullHash ^= ullHash >> 29U;
+			ullHash *= Q_HASH_XXH64_THIRD;
+			ullHash ^= ullHash >> 32U;
+			return ullHash;
+		}
+
+		/// @param[in] pSource either bytes of the buffer or characters of the string
+		/// @returns: calculated hash of the given data
+		template <typename T>
+		constexpr XXH64_t HashBytes(const T* pSource, const std::size_t nLength, const std::uint64_t ullSeed) noexcept
+		{
+			const State_t state = ProcessBody(pSource, nLength, MakeState(ullSeed));
+			return ProcessTail(pSource + (nLength & ~static_cast<std::size_t>(31U)), nLength & 31U, state, nLength);
+		}
+	}
+
+	/// @param[in] pSource buffer for which the hash will be generated
+	/// @param[in] nLength length of the source buffer in bytes
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given buffer
+	constexpr XXH64_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(pSource, nLength, ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	inline XXH64_t Hash(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		// the length is mixed only at the finalization, so the whole stripes are mixed right behind the terminator search
+		DETAIL::State_t state = DETAIL::MakeState(ullSeed);
+		const std::uint8_t* pStripe = reinterpret_cast<const std::uint8_t*>(szSource);
+		const std::size_t nLength = Q_HASH::SIMD::ScanString(szSource, [&](const std::uint8_t* pSpanEnd)
+		{
+			const std::size_t nBodyLength = static_cast<std::size_t>(pSpanEnd - pStripe) & ~static_cast<std::size_t>(31U);
+			state = DETAIL::ProcessBody(pStripe, nBodyLength, state);
+			pStripe += nBodyLength;
+		});
+
+		return DETAIL::ProcessTail(pStripe, nLength & 31U, state, nLength);
+	}
+
+	/// @param[in] strSource string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string
+	constexpr XXH64_t Hash(const std::string_view strSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return DETAIL::HashBytes(strSource.data(), strSource.size(), ullSeed);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	consteval XXH64_t HashConst(const char* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+#ifdef Q_CRT
+		const std::size_t nLength = CRT::StringLength(szSource);
+#else
+		const char* szSourceEnd = szSource;
+		while (*szSourceEnd != '\0')
+			++szSourceEnd;
+
+		const std::size_t nLength = szSourceEnd - szSource;
+#endif
+		return DETAIL::HashBytes(szSource, nLength, ullSeed);
+	}
+
+	/* @section: stream */
+	/// incremental hash generation of the data split across multiple buffers
+	class CStream
+	{
+	public:
+		/// @param[in] ullSeed initial key of the hash generation
+		explicit CStream(const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			Init(ullSeed);
+		}
+
+		/// reset the state to begin a new hash generation
+		/// @param[in] ullSeed initial key of the hash generation
+		void Init(const std::uint64_t ullSeed = 0ULL) noexcept
+		{
+			state = DETAIL::MakeState(ullSeed);
+			nTotalLength = 0U;
+			nTailLength = 0U;
+		}
+
+		/// @param[in] pSource next buffer of the data
+		/// @param[in] nLength length of the buffer in bytes
+		void Update(const std::uint8_t* pSource, std::size_t nLength) noexcept
+		{
+			nTotalLength += nLength;
+
+			// complete the stripe that was left from the previous buffer
+			if (nTailLength != 0U)
+			{
+				while (nTailLength < sizeof(arrTail) && nLength != 0U)
+				{
+					arrTail[nTailLength++] = *pSource++;
+					--nLength;
+				}
+
+				if (nTailLength < sizeof(arrTail))
+					return;
+
+				state = DETAIL::ProcessBody(arrTail, sizeof(arrTail), state);
+				nTailLength = 0U;
+			}
+
+			state = DETAIL::ProcessBody(pSource, nLength, state);
+
+			// keep the remaining bytes until the next buffer
+			for (const std::uint8_t* pTail = pSource + (nLength & ~static_cast<std::size_t>(31U)); nTailLength < (nLength & 31U); ++nTailLength)
+				arrTail[nTailLength] = pTail[nTailLength];
+		}
+
+		/// @param[in] ppSources array of the next buffers of the data, in order
+		/// @param[in] pLengths array of the length of each buffer in bytes
+		/// @param[in] nCount count of the buffers
+		void Update(const std::uint8_t* const* ppSources, const std::size_t* pLengths, const std::size_t nCount) noexcept
+		{
+			for (std::size_t i = 0U; i < nCount; ++i)
+				Update(ppSources[i], pLengths[i]);
+		}
+
+		/// @returns: calculated hash of the all appended data
+		[[nodiscard]] XXH64_t Final() const noexcept
+		{
+			return DETAIL::ProcessTail(arrTail, nTailLength, state, nTotalLength);
+		}
+
+	private:
+		DETAIL::State_t state;
+		std::size_t nTotalLength;
+		std::uint8_t arrTail[sizeof(std::uint64_t) * 4U];
+		std::size_t nTailLength;
+	};
+
+	/* @section: characters */
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	inline XXH64_t Hash(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<false>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated hash of the given string, equal to the hash of its narrow lowercase copy
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	inline XXH64_t Hash(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashString<true>(CStream(ullSeed), szSource);
+	}
+
+	/// @param[in] szSource null-terminated wide string for which the hash will be generated, its characters are narrowed to the low byte
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsWideCharacter<TChar>)
+	consteval XXH64_t HashConst(const TChar* szSource, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<false>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+
+	/// @param[in] szSource null-terminated string for which the hash will be generated, ignoring the case of its ASCII letters
+	/// @param[in] ullSeed initial key of the hash generation
+	/// @returns: calculated at compile-time hash of the given string
+	template <typename TChar> requires (Q_HASH::FOLD::IsCharacter<TChar>)
+	consteval XXH64_t HashConst(const TChar* szSource, Q_HASH::IgnoreCase_t, const std::uint64_t ullSeed = 0ULL) noexcept
+	{
+		return Q_HASH::FOLD::HashConst<true>(szSource, [ullSeed](const std::uint8_t* pFolded, const std::size_t nLength) { return Hash(pFolded, nLength, ullSeed); });
+	}
+}
+
+/*
+ * UNIFORM INTERFACE FOR THE GENERIC FACILITIES
+ */
+namespace Q_HASH::ALGORITHM
+{
+	struct XXH64
+	{
+		using Hash_t = XXH64_t;
+		static constexpr bool bAvalanching = true;
+
+		/// @param[in] uSeed seed of the hash generation
+		static Hash_t Hash(const std::uint8_t* pSource, const std::size_t nLength, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH64::Hash(pSource, nLength, uSeed);
+		}
+
+		/// @param[in] uSeed seed of the hash generation
+		static consteval Hash_t HashConst(const char* szSource, const std::uint32_t uSeed = 0U) noexcept
+		{
+			return ::XXH64::HashConst(szSource, uSeed);
+		}
+	};
+}
+
+#ifndef Q_HASH_NO_LITERALS
+/*
+ * USER-DEFINED LITERALS
+ */
+namespace Q_HASH::LITERALS
+{
+	/// @returns: calculated at compile-time hash of the given string literal, e.g. '"example"_xxh64'
+	consteval XXH64_t operator""_xxh64(const char* szSource, const std::size_t nLength) noexcept
+	{
+		return XXH64::DETAIL::HashBytes(szSource, nLength, 0U);
+	}
+}
+#endif